@@ -27,6 +27,7 @@ THE SOFTWARE.
 #ifndef _core_Array_H
 #define _core_Array_H
 
+#include <cstring>
 #include <clasp/core/clasp_gmpxx.h>
 #include <clasp/core/object.h>
 #include <clasp/core/numbers.h> // need full definitions for to_object.
@@ -179,35 +180,32 @@ namespace core {
   [[noreturn]] void notVectorError(T_sp array);
   bool ranged_bit_vector_EQ_(const SimpleBitVector_O& x, const SimpleBitVector_O& y, size_t startx, size_t endx, size_t starty, size_t endy );
 
+  /*! Compare NUM characters of two strings.  Strings with the same character
+      width go through memcmp, which the C library does a vector register at a time. */
+  template <typename C1, typename C2>
+    inline bool string_chars_equal(const C1* cp1, const C2* cp2, size_t num)
+  {
+    for ( size_t i=0; i<num; ++i ) {
+      if (static_cast<claspCharacter>(cp1[i]) != static_cast<claspCharacter>(cp2[i])) return false;
+    }
+    return true;
+  }
+
+  template <typename C>
+    inline bool string_chars_equal(const C* cp1, const C* cp2, size_t num)
+  {
+    return memcmp(cp1,cp2,num*sizeof(C)) == 0;
+  }
+
   template <typename T1,typename T2>
     bool template_string_EQ_equal(const T1& string1, const T2& string2, size_t start1, size_t end1, size_t start2, size_t end2)
   {
-    const typename T1::simple_element_type* cp1(&string1[start1]);
-    const typename T2::simple_element_type* cp2(&string2[start2]);
     size_t num1 = end1 - start1;
     size_t num2 = end2 - start2;
-//    printf("%s:%d:%s string1@%p string2=@%p sizeof(*cp1)=%lu sizeof(*cp2)=%lu cp1=%p cp2=%p start1=%lu end1=%lu start2=%lu end2=%lu num1=%lu num2=%lu\n", __FILE__, __LINE__, __FUNCTION__, (void*)&string1, (void*)&string2, sizeof(*cp1), sizeof(*cp2), (void*)cp1, (void*)cp2, start1, end1, start2, end2, num1, num2);
-    while (1) {
-      if (num1 == 0)
-        goto END_STRING1;
-      if (num2 == 0)
-        goto END_STRING2;
-      if ((static_cast<claspCharacter>(*cp1) != static_cast<claspCharacter>(*cp2)))
-        goto RETURN_FALSE;
-      --num1;
-      --num2;
-      ++cp1;
-      ++cp2;
-    }
-  END_STRING1:
-    if (num2 == 0)
-      goto RETURN_TRUE;
-    goto RETURN_FALSE;
-  END_STRING2:
-  RETURN_FALSE:
-    return false;
-  RETURN_TRUE:
-    return true;
+    if (num1 != num2) return false;
+    const typename T1::simple_element_type* cp1(&string1[start1]);
+    const typename T2::simple_element_type* cp2(&string2[start2]);
+    return string_chars_equal(cp1,cp2,num1);
   }
 
   template <class SimpleType>
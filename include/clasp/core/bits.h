@@ -1,6 +1,8 @@
 #ifndef core_bits_H
 #define core_bits_H
 
+#include <clasp/core/array.h>
+
 namespace core {
 
 typedef enum { boole_clr = 0,
@@ -20,6 +22,10 @@ typedef enum { boole_clr = 0,
                boole_nand = 14,
                boole_set = 15 } boole_ops;
 
+size_t bit_vector_count_ones(const SimpleBitVector_O::value_type* data, size_t start, size_t end);
+gctools::Fixnum bit_vector_position(const SimpleBitVector_O::value_type* data, size_t start, size_t end, uint bit, bool from_end);
+bool bit_vector_ranges_equal(const SimpleBitVector_O::value_type* x, size_t startx, const SimpleBitVector_O::value_type* y, size_t starty, size_t len);
+
 void initialize_bits();
 };
 
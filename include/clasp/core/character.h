@@ -47,8 +47,40 @@ int clasp_string_case(String_sp s);
 Fixnum clasp_digitp(claspCharacter ch, int basis);
 
 bool cl__standard_char_p(Character_sp ch);
-bool clasp_islower_wide(claspCharacter code);
-bool clasp_isupper_wide(claspCharacter code);
+
+/*! Unicode character properties.  tools-for-build/unicode_tables.py generates
+    them into unicodeTables.cc as a two level table: the high bits of a code
+    pick a block of property indices, the low UNICODE_BLOCK_SHIFT bits pick
+    the entry within it. */
+#define UNICODE_BLOCK_SHIFT 7
+
+enum { unicode_upper = 1,
+       unicode_lower = 2,
+       unicode_alpha = 4,
+       unicode_alphanumeric = 8,
+       unicode_graphic = 16 };
+
+struct UnicodeProperties {
+  uint8_t category;   // index into unicode_general_category_names
+  uint8_t flags;
+  int32_t case_delta; // add to an upper or lower case character to get the other case
+};
+
+extern const char* unicode_general_category_names[];
+extern const UnicodeProperties unicode_properties[];
+extern const uint8_t unicode_property_blocks[];
+extern const uint8_t unicode_property_records[][1<<UNICODE_BLOCK_SHIFT];
+
+inline const UnicodeProperties& clasp_unicode_properties(claspCharacter code) {
+  uint32_t ucode = static_cast<uint32_t>(code);
+  if (ucode >= CHAR_CODE_LIMIT) return unicode_properties[0];
+  uint8_t block = unicode_property_blocks[ucode>>UNICODE_BLOCK_SHIFT];
+  return unicode_properties[unicode_property_records[block][ucode&((1<<UNICODE_BLOCK_SHIFT)-1)]];
+}
+
+inline bool clasp_unicode_property_p(claspCharacter code, uint8_t flag) {
+  return (clasp_unicode_properties(code).flags & flag) != 0;
+}
 
 class Character_dummy_O : public General_O {
   LISP_ABSTRACT_CLASS(core, ClPkg, Character_dummy_O, "character",core::General_O);
@@ -120,19 +152,19 @@ inline bool clasp_invalid_base_char_p(int c) {
 }
 
 inline claspCharacter claspCharacter_upcase(claspCharacter code) {
-  // Should probably be towupper, but doesn't work. not even in Xcode
-  claspCharacter uc = toupper(code);
-  return uc;
+  const UnicodeProperties& props = clasp_unicode_properties(code);
+  if (props.flags & unicode_lower) return code + props.case_delta;
+  return code;
 }
 
 inline claspCharacter claspCharacter_downcase(claspCharacter code) {
-  // Should probably be towlower, but doesn't work. not even in Xcode
-  claspCharacter uc = tolower(code);
-  return uc;
+  const UnicodeProperties& props = clasp_unicode_properties(code);
+  if (props.flags & unicode_upper) return code + props.case_delta;
+  return code;
 }
 
 inline bool clasp_alphanumericp(claspCharacter i) {
-  return isalnum(i);
+  return clasp_unicode_property_p(i,unicode_alphanumeric);
 }
 
 
@@ -152,17 +184,11 @@ inline bool clasp_alphanumericp(claspCharacter i) {
  }
 
  inline bool clasp_isupper(claspCharacter cc) {
-   if (cc>255) {
-     return clasp_isupper_wide(cc);
-   }
-   else return isupper(cc);
+   return clasp_unicode_property_p(cc,unicode_upper);
  }
 
 inline bool clasp_islower(claspCharacter cc) {
-   if (cc>255) {
-     return clasp_islower_wide(cc);
-   }
-   else return islower(cc);
+   return clasp_unicode_property_p(cc,unicode_lower);
  }
 
 inline Character_sp clasp_make_standard_character(claspCharacter c) {
@@ -229,6 +229,11 @@ typedef int  claspCharacter;
 /*! Maximum number of arguments that can be passed */
 #define CALL_ARGUMENTS_LIMIT 136
 
+/*! APPLY and the frame/vaslist funcall paths pass arguments beyond
+    CALL_ARGUMENTS_LIMIT on the stack - this bound is only used to catch
+    corrupt argument counts in debug builds */
+#define APPLY_ARGUMENTS_SANITY_LIMIT (1024 * 1024)
+
 #define CHAR_CODE_LIMIT 1114112
 
 #define CLASP_INTERNAL_TIME_UNITS_PER_SECOND 1000000000
@@ -72,6 +72,7 @@ THE SOFTWARE.
 
 #define RUN_ALL_FUNCTION_NAME "RUN-ALL"
 #define CLASP_CTOR_FUNCTION_NAME "CLASP-CTOR"
+#define CLASP_FASL_INIT_FUNCTION_NAME "CLASP-FASL-INIT"
 
 #ifdef CLASP_THREADS
 #include <atomic>
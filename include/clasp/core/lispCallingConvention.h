@@ -399,6 +399,11 @@ inline bool dump_Vaslist_ptr(Vaslist* args_orig) {
     
                        
 
+/*! Call a function with any number of arguments in a VaList_sp.
+The arguments that don't fit in registers are copied into a stack allocated
+area that the callee sees as its overflow argument area - see evaluator.cc */
+gctools::return_type funcall_consume_valist_spread(T_O* func_tagged, VaList_sp args);
+
 /*! Call a function object with args in a VaList_sp and consume the valist.
 The Callee can NOT use args after this call.
 Note: Since we don't have the full Function_O class definition when this
@@ -417,11 +422,10 @@ inline gctools::return_type funcall_consume_valist_(gc::Tagged func_tagged, VaLi
 #include <clasp/core/applyToFrame.h>
 #undef APPLY_TO_VA_LIST_CASE
   default:
-      printf("%s:%d Called %s with %lu arguments - add support for calls with this arity or reduce the number of args in this call\n", __FILE__, __LINE__, _rep_(func).c_str(), nargs);
-      SIMPLE_ERROR_SPRINTF("Illegal arity %lu for funcall",  nargs);
-      break;
+      // More arguments than applyToFrame.h has cases for - spread them on the stack
+      return funcall_consume_valist_spread(func.raw_(),args);
   }
-  SIMPLE_ERROR_SPRINTF("Unsupported arity %lu must be less than %lu",  nargs, CALL_ARGUMENTS_LIMIT );
+  SIMPLE_ERROR_SPRINTF("Unsupported arity %lu",  nargs );
 }
 /*! Return (values arguments closure) */
 T_mv capture_arguments(uintptr_t functionAddress, uintptr_t basePointer, int frameOffset);
@@ -440,14 +440,23 @@ class StringOutputStream_O : public StringStream_O {
   friend String_sp &StringOutputStreamOutputString(T_sp);
   LISP_CLASS(core, CorePkg, StringOutputStream_O, "string-output-stream",StringStream_O);
   //    DECLARE_ARCHIVE();
-public: // Simple default ctor/dtor
-  DEFAULT_CTOR_DTOR(StringOutputStream_O);
+public:
+  StringOutputStream_O() : _Chunks(_Nil<T_O>()), _ChunksLength(0), _Chunked(false), _Extended(false){};
 
 public: // ctor/dtor for classes with shared virtual base
         //    explicit StringStream_O(core::Instance_sp const& mc) : T_O(mc),AnsiStream(mc) {};
         //    virtual ~StringStream_O() {};
 public: // instance variables here
+  /*! The string being written to.  For a chunked stream this is the
+      current chunk, a fill-pointer string that is never regrown. */
   String_sp _Contents;
+  /*! Full chunks, newest first, and the number of characters in them */
+  List_sp _Chunks;
+  cl_index _ChunksLength;
+  /*! The stream owns its buffer and grows it a chunk at a time */
+  bool _Chunked;
+  /*! The element-type is CHARACTER; chunks start out as base strings */
+  bool _Extended;
 
 public: // Functions here
   void fill(const string &data);
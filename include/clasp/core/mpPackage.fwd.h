@@ -108,6 +108,7 @@ void debug_mutex_unlock(Mutex* m);
 #define JITDOBJS_NAMEWORD 0x004a424f4454494a
 #define EXITBARR_NAMEWORD 0x0052414254495845
 #define DISSASSM_NAMEWORD 0x0053534153534944
+#define OBJFASLS_NAMEWORD 0x004c5341464a424f
 
 struct Mutex {
   uint64_t _NameWord;
@@ -40,16 +40,55 @@ namespace core {
   
 SMART(RandomState);
 
+/*! xoshiro256** (Blackman and Vigna) - a 64 bit generator with a period of 2^256-1
+    that is several times faster than mt19937 and models the UniformRandomNumberGenerator
+    concept so the boost distributions accept it.
+    jump() advances the state by 2^128 draws so one seed can be split into
+    non-overlapping streams, one per thread. */
+struct Xoshiro256ss {
+  typedef uint64_t result_type;
+  uint64_t _State[4];
+  explicit Xoshiro256ss(uint64_t seed = 0) { this->seed(seed); };
+  static constexpr result_type min() { return 0; };
+  static constexpr result_type max() { return ~(result_type)0; };
+  static inline uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+  //! Expand the seed with splitmix64 so that nearby seeds give unrelated states
+  void seed(uint64_t seed) {
+    for ( size_t i=0; i<4; ++i ) {
+      uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      this->_State[i] = z ^ (z >> 31);
+    }
+  };
+  inline result_type operator()() {
+    uint64_t* s = this->_State;
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+  };
+  void jump();
+};
+
 class RandomState_O : public General_O {
   LISP_CLASS(core, ClPkg, RandomState_O, "random-state",General_O);
   //    DECLARE_ARCHIVE();
 public: // Simple default ctor/dtor
   typedef boost::mt19937 Generator;
+  typedef enum { mt19937_generator, xoshiro256_generator } GeneratorKind;
+  GeneratorKind _Kind;
   Generator _Producer;
+  Xoshiro256ss _Xoshiro;
 //  boost::mt11213b _Producer;
 
 public: // ctor/dtor for classes with shared virtual base
-  explicit RandomState_O(bool random = false) {
+  explicit RandomState_O(bool random = false, GeneratorKind kind = mt19937_generator) : _Kind(kind) {
     if (random) {
       clock_t currentTime;
 #ifdef darwin
@@ -61,24 +100,40 @@ public: // ctor/dtor for classes with shared virtual base
       tt = currentTime % 32768;
       Generator temp_gen(static_cast<uint>(tt));
       this->_Producer = temp_gen; // this->_Producer.seed(tt);
+      this->_Xoshiro.seed(currentTime);
     } else {
       Generator temp_gen(0);
       this->_Producer = temp_gen; //this->_Producer.seed(0);
     }
   };
   explicit RandomState_O(const RandomState_O &state) {
+    this->_Kind = state._Kind;
     this->_Producer = state._Producer;
+    this->_Xoshiro = state._Xoshiro;
   };
   virtual ~RandomState_O() {}
 
   CL_DEFMETHOD std::string random_state_get() {
     stringstream ss;
-    ss << this->_Producer;
+    if (this->_Kind == xoshiro256_generator) {
+      ss << "xoshiro256";
+      for ( size_t i=0; i<4; ++i ) ss << " " << this->_Xoshiro._State[i];
+    } else {
+      ss << this->_Producer;
+    }
     return ss.str();
   }
   CL_DEFMETHOD void random_state_set(const std::string& s) {
     stringstream ss(s);
-    ss >> this->_Producer;
+    if (s.compare(0,10,"xoshiro256") == 0) {
+      std::string tag;
+      ss >> tag;
+      for ( size_t i=0; i<4; ++i ) ss >> this->_Xoshiro._State[i];
+      this->_Kind = xoshiro256_generator;
+    } else {
+      ss >> this->_Producer;
+      this->_Kind = mt19937_generator;
+    }
   }
 
  public: // Functions here
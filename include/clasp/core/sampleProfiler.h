@@ -0,0 +1,82 @@
+/*
+    File: sampleProfiler.h
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+
+See directory 'clasp/licenses' for full details.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+
+#if !defined(CLASP_CORE_SAMPLE_PROFILER_H)
+#define CLASP_CORE_SAMPLE_PROFILER_H
+
+#include <atomic>
+#include <clasp/core/foundation.h>
+#include <clasp/core/corePackage.h>
+
+namespace core {
+
+/*! The maximum number of return addresses recorded for one sample */
+#define SAMPLE_PROFILER_MAX_DEPTH 128
+#define SAMPLE_PROFILER_DEFAULT_FREQUENCY 97
+#define SAMPLE_PROFILER_DEFAULT_MAX_SAMPLES 100000
+
+/*! One stack sample captured by the SIGPROF handler.
+    _Depth is written last (with release semantics) and a sample
+    is only read once _Depth is nonzero. */
+struct ProfileSample {
+  std::atomic<uint32_t> _Depth;
+  uintptr_t _Thread;
+  uintptr_t _Frames[SAMPLE_PROFILER_MAX_DEPTH];
+};
+
+/*! The sampling profiler state.
+    The sample buffer is allocated when the profiler is started and
+    slots are claimed by the signal handler with an atomic increment so
+    that nothing is allocated and no locks are taken in the handler.
+    _ActiveHandlers counts the handlers that are running on any thread -
+    the buffer is only freed once it has been swapped out and they are done. */
+struct SampleProfiler {
+  std::atomic<bool> _Enabled;
+  bool _HandlerInstalled;
+  size_t _Frequency;
+  size_t _MaxSamples;
+  std::atomic<ProfileSample*> _Samples;
+  std::atomic<size_t> _NextSample;
+  std::atomic<size_t> _DroppedSamples;
+  std::atomic<size_t> _ActiveHandlers;
+  SampleProfiler() : _Enabled(false), _HandlerInstalled(false), _Frequency(0), _MaxSamples(0), _Samples(NULL), _NextSample(0), _DroppedSamples(0), _ActiveHandlers(0) {};
+};
+
+extern SampleProfiler global_SampleProfiler;
+
+/*! Cheap check used by code that wants to avoid work when the profiler is off */
+inline bool sample_profiler_enabled_p() {
+  return global_SampleProfiler._Enabled.load(std::memory_order_relaxed);
+}
+
+void core__sampling_profiler_start(size_t frequency, size_t max_samples);
+void core__sampling_profiler_stop();
+void core__sampling_profiler_reset();
+
+};
+
+#endif
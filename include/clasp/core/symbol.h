@@ -46,7 +46,6 @@ THE SOFTWARE.
 #define IS_MACRO    0x04
 
 namespace core {
-#define NO_THREAD_LOCAL_BINDINGS std::numeric_limits<size_t>::max()
 SMART(Package);
 SMART(NamedFunction);
 FORWARD(ClassHolder);
@@ -111,10 +110,16 @@ public:
   }
   
   
+  /*! Return true if no thread has ever dynamically bound this symbol.
+      Then the value is always in _GlobalValue. */
+  inline bool neverDynamicallyBoundP() const {
+    return this->_BindingIdx.load(std::memory_order_relaxed) == NO_THREAD_LOCAL_BINDINGS;
+  }
+
   /*! Return a pointer to the value cell */
   inline T_sp *valueReference(T_sp* globalValuePtr) {
 #ifdef CLASP_THREADS
-    return my_thread->_Bindings.reference_raw(this,globalValuePtr);
+    return my_thread->_Bindings.reference_index(this->_BindingIdx.load(std::memory_order_relaxed),globalValuePtr);
 #else
     return globalValuePtr;
 #endif
@@ -122,7 +127,7 @@ public:
 
   inline const T_sp *valueReference(const T_sp* globalValuePtr) const {
 #ifdef CLASP_THREADS
-    return my_thread->_Bindings.reference_raw(this,globalValuePtr);
+    return my_thread->_Bindings.reference_index(this->_BindingIdx.load(std::memory_order_relaxed),const_cast<T_sp*>(globalValuePtr));
 #else
     return globalValuePtr;
 #endif
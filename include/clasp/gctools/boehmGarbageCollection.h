@@ -56,6 +56,25 @@ namespace gctools {
 
 };
 
+namespace gctools {
+  /*! Number of power-of-two buckets in the GC pause histogram.
+      Bucket i counts world-stopped pauses shorter than 2^i microseconds. */
+#define GC_PAUSE_HISTOGRAM_BUCKETS 32
+  /*! Filled in by the Boehm collection event callback, which runs with the
+      allocation lock held, so the fields are only written by one thread at a time. */
+  struct GCPauseHistogram {
+    size_t _Buckets[GC_PAUSE_HISTOGRAM_BUCKETS];
+    size_t _Count;
+    size_t _TotalMicroseconds;
+    size_t _MaxMicroseconds;
+    size_t _Collections;
+    struct timespec _StopStart;
+  };
+  extern GCPauseHistogram global_gc_pause_histogram;
+  extern bool global_boehm_incremental;
+  void boehm_reset_pause_histogram();
+};
+
 namespace gctools {
 
   void boehm_set_finalizer_list(gctools::Tagged object, gctools::Tagged finalizers );
@@ -114,7 +114,7 @@ DO NOT CHANGE THE ORDER OF THESE OBJECTS WITHOUT UPDATING THE DEFINITION OF +va_
 
 #ifdef _DEBUG_BUILD
   inline void check_remaining_nargs() const {
-    if (this->_remaining_nargs >CALL_ARGUMENTS_LIMIT) {
+    if (this->_remaining_nargs >APPLY_ARGUMENTS_SANITY_LIMIT) {
       printf("%s:%d  this->_remaining_nargs has bad value %lu\n", __FILE__, __LINE__, this->_remaining_nargs);
     }
   }
@@ -91,6 +91,40 @@ class root_allocator : public traceable_allocator<T> {};
 
 namespace gctools {
 #ifdef USE_BOEHM
+  /*! When precise marking is enabled (see initializeBoehm) objects whose stamp
+      has an exact layout in global_stamp_layout are allocated in this Boehm
+      object kind. Its mark procedure only traces the pointer fields in the layout. */
+  extern int global_boehm_precise_kind;
+  extern unsigned char* global_boehm_precise_stamps;
+  extern size_t global_boehm_precise_stamps_max;
+  inline bool boehm_precise_stamp_p(GCStampEnum stamp) {
+    return global_boehm_precise_stamps
+      && (size_t)stamp <= global_boehm_precise_stamps_max
+      && global_boehm_precise_stamps[stamp];
+  }
+
+  /*! Allocate SIZE cleared bytes in the precise kind.  GC_generic_malloc takes
+      the allocator lock every time, so small objects are taken from a free list
+      of this thread that GC_generic_malloc_many refills a block at a time - what
+      GC_MALLOC does for the normal kind.  Call with interrupts disabled. */
+  inline void* boehm_precise_allocation(size_t size) {
+    size_t granules = (size+GC_GRANULE_BYTES-1)/GC_GRANULE_BYTES;
+    if (granules < BOEHM_PRECISE_FREE_LISTS) {
+      void** free_list = &my_thread_low_level->_BoehmPreciseFreeLists[granules];
+      if (!*free_list) {
+        GC_generic_malloc_many(granules*GC_GRANULE_BYTES,global_boehm_precise_kind,free_list);
+      }
+      void* result = *free_list;
+      if (result) {
+        *free_list = GC_NEXT(result);
+        // The kind clears new objects, only the link word is left
+        GC_NEXT(result) = NULL;
+        return result;
+      }
+    }
+    return GC_generic_malloc(size,global_boehm_precise_kind);
+  }
+
   inline Header_s* do_boehm_atomic_allocation(const Header_s::Value& the_header, size_t size) 
   {
     RAII_DISABLE_INTERRUPTS();
@@ -117,7 +151,12 @@ namespace gctools {
     size_t tail_size = ((rand()%8)+1)*Alignment();
     true_size += tail_size;
 #endif
-    Header_s* header = reinterpret_cast<Header_s*>(GC_MALLOC(true_size));
+    Header_s* header;
+    if (boehm_precise_stamp_p(the_header.stamp())) {
+      header = reinterpret_cast<Header_s*>(boehm_precise_allocation(true_size));
+    } else {
+      header = reinterpret_cast<Header_s*>(GC_MALLOC(true_size));
+    }
     my_thread_low_level->_Allocations.registerAllocation(the_header.stamp(),true_size);
 #ifdef DEBUG_GUARD
     memset(header,0x00,true_size);
@@ -370,6 +409,54 @@ extern void bad_general_mps_reserve_error(mps_ap_t* allocation_point);
           cons_mps_allocation<Cons>(obj_ap,"CONS",
                               std::forward<ARGS>(args)...);
         return obj;
+#endif
+    }
+
+    /*! Allocate a list of N conses with as few trips into the GC as possible.
+        The car of the i-th cons is INIT(i) - INIT is called in order and may
+        allocate.  The cdr of the last cons is TAIL.  N must be > 0. */
+    template <class Init, class Tail>
+    static smart_ptr<Cons> allocate_list(size_t n, Init&& init, Tail tail) {
+#ifdef USE_BOEHM
+      Cons* first = NULL;
+      Cons* last = NULL;
+      for (size_t i = 0; i < n; ++i) {
+        Cons* cons;
+        { RAII_DISABLE_INTERRUPTS();
+          // GC_malloc_many returns a free list of cleared objects linked through
+          // their first word.  What this list doesn't use is kept for the next one,
+          // so short lists don't throw away most of a chunk.
+          void* free = my_thread_low_level->_ConsFreeList;
+          if (!free) {
+            free = GC_malloc_many(sizeof(Cons));
+            if (!free) throw_hard_error("Out of memory in ConsAllocator::allocate_list");
+          }
+          // Unlink before INIT runs, it may allocate lists too
+          my_thread_low_level->_ConsFreeList = GC_NEXT(free);
+          cons = reinterpret_cast<Cons*>(free);
+        }
+        new (cons) Cons(init(i), tail);
+        if (last) {
+          last->rplacd(smart_ptr<Cons>((Tagged)tag_cons(cons)));
+        } else {
+          first = cons;
+        }
+        last = cons;
+      }
+      my_thread_low_level->_Allocations.registerAllocation(STAMP_CONS,sizeof(Cons)*n);
+      handle_all_queued_interrupts();
+      return smart_ptr<Cons>((Tagged)tag_cons(first));
+#endif
+#ifdef USE_MPS
+      // MPS allocation points are already bump allocators - just fill in order
+      smart_ptr<Cons> first = allocate(init(0), tail);
+      smart_ptr<Cons> last = first;
+      for (size_t i = 1; i < n; ++i) {
+        smart_ptr<Cons> cons = allocate(init(i), tail);
+        last->rplacd(cons);
+        last = cons;
+      }
+      return first;
 #endif
     }
   };
@@ -1,14 +1,32 @@
 #ifndef gctools_interrupt_H
 #define gctools_interrupt_H
 
+#include <clasp/gctools/threadlocal.fwd.h>
+
+/*! Global safepoint polling word for compiled code - the number of threads
+    that have queued interrupts.  Compiled code can't cheaply reach the
+    thread local polling word so it checks this one at function entry and
+    at loop heads and calls cc_safepoint when it is nonzero. */
+extern "C" std::atomic<uint32_t> clasp_safepoint_word;
+
 namespace gctools {
 
   void clasp_interrupt_process(mp::Process_sp process, core::T_sp function);
   
   void handle_or_queue(core::T_sp signal_code /*, int code */);
-  void handle_all_queued_interrupts();
+  void handle_all_queued_interrupts_slow();
   void initialize_signals(int clasp_signal);
   void initialize_unix_signal_handlers();
+  /*! Called by a thread as it exits - see start_thread_inner */
+  void release_safepoint_word(core::ThreadLocalState* thread);
+
+  /*! Safepoint - poll the thread local word and only call out of line
+      when there is something queued.  Cheap enough to call after every allocation. */
+  inline void handle_all_queued_interrupts() {
+    if (__builtin_expect(my_thread_low_level->_PendingInterruptsWord.load(std::memory_order_relaxed)!=0,0)) {
+      handle_all_queued_interrupts_slow();
+    }
+  }
   
 };
 
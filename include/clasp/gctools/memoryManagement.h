@@ -40,6 +40,8 @@ THE SOFTWARE.
 #endif
 #include <gc/gc.h>
 #include <gc/gc_allocator.h>
+#include <gc/gc_mark.h>
+#include <gc/gc_inline.h>
 typedef void *LocationDependencyPtrT;
 #endif // USE_BOEHM
 
@@ -20,6 +20,10 @@ namespace core {
 
 
 namespace core {
+/*! The binding index of a symbol that has never been dynamically bound */
+#define NO_THREAD_LOCAL_BINDINGS std::numeric_limits<size_t>::max()
+/*! The initial size of the thread local binding table of a new thread */
+#define INITIAL_THREAD_LOCAL_BINDINGS 1024
   class DynamicBinding {
   public:
     Symbol_sp _Var;
@@ -46,6 +50,18 @@ namespace core {
     void reserve(size_t x) { this->_Bindings.reserve(x); };
     size_t size() const { return this->_Bindings.size(); };
     void expandThreadLocalBindings(size_t index);
+    /*! Return a pointer to the value slot for the symbol with the binding index.
+        A symbol that has never been dynamically bound in any thread has the index
+        NO_THREAD_LOCAL_BINDINGS and its global value is used directly.
+        An index beyond the end of this thread's table means the symbol was never
+        bound in this thread - reading doesn't need to grow the table. */
+    inline T_sp* reference_index(size_t index, T_sp* globalValuePtr) const {
+      if ( index == NO_THREAD_LOCAL_BINDINGS ) return globalValuePtr;
+      unlikely_if (index >= this->_ThreadLocalBindings.size()) return globalValuePtr;
+      T_sp* slot = &this->_ThreadLocalBindings[index];
+      if (gctools::tagged_no_thread_local_bindingp(slot->raw_())) return globalValuePtr;
+      return slot;
+    }
     // Dynamic symbol access
     /*! Return a pointer to the value slot for the symbol.  
         USE THIS IMMEDIATELY AND THEN DISCARD.
@@ -2,6 +2,7 @@
 #define gctools_threadlocal_fwd_H
 
 #include <signal.h>
+#include <atomic>
 
 namespace gctools {
 
@@ -76,9 +77,26 @@ namespace gctools {
 
 
 
+  /*! Objects of the Boehm precise kind up to this many granules come from
+      per thread free lists - see boehm_precise_allocation */
+#define BOEHM_PRECISE_FREE_LISTS 32
+
   struct ThreadLocalStateLowLevel {
     void*                  _StackTop;
     int                    _DisableInterrupts;
+    /*! Safepoint polling word - nonzero while the thread has queued interrupts.
+        Written by other threads and signal handlers, read at every safepoint. */
+    std::atomic<uint32_t>  _PendingInterruptsWord;
+    /*! Cleared conses left over from the last GC_malloc_many chunk, linked
+        through their first word - see ConsAllocator::allocate_list.  This
+        object lives on the thread's stack, so the collector sees the list. */
+    void*                  _ConsFreeList;
+#ifdef USE_BOEHM
+    /*! Free lists of the precise object kind indexed by size in granules,
+        refilled with GC_generic_malloc_many.  Like _ConsFreeList they are
+        seen by the collector because this object is on the thread's stack. */
+    void*                  _BoehmPreciseFreeLists[BOEHM_PRECISE_FREE_LISTS];
+#endif
     GlobalAllocationProfiler _Allocations;
 #ifdef DEBUG_COUNT_ALLOCATIONS
     std::vector<size_t>    _CountAllocations;
@@ -45,6 +45,8 @@ namespace core {
     /*! SingleDispatchGenericFunction cache */
     Cache_sp _SingleDispatchMethodCachePtr;
 #endif
+    /*! The low level state of this thread - holds the safepoint polling word */
+    gctools::ThreadLocalStateLowLevel* _LowLevel;
     /*! Pending interrupts */
     List_sp _PendingInterrupts;
     /*! Save CONS records so we don't need to do allocations
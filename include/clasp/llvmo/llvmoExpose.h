@@ -59,6 +59,7 @@ THE SOFTWARE.
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Constants.h>
 #include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
 #include <llvm/ExecutionEngine/Orc/IRCompileLayer.h>
 #include <llvm/ExecutionEngine/Orc/IRTransformLayer.h>
 #include <llvm/ExecutionEngine/Orc/LambdaResolver.h>
@@ -4078,6 +4079,7 @@ struct from_object<llvm::CmpInst::Predicate, std::true_type> {
 
 namespace llvmo {
   void finalizeEngineAndRegisterWithGcAndRunMainFunctions(ExecutionEngine_sp oengine);
+  void loadObjectFaslAndRunInitFunction(std::unique_ptr<llvm::object::ObjectFile> object, std::unique_ptr<llvm::MemoryBuffer> buffer, const std::string& fasl);
 
   Module_sp llvm_sys__parseBitcodeFile(core::T_sp filename, LLVMContext_sp context);
   Module_sp llvm_sys__parseIRFile(core::T_sp filename, LLVMContext_sp context);
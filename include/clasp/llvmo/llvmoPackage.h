@@ -56,6 +56,7 @@ void redirect_llvm_interface_addSymbol();
 
  bool llvm_sys__load_bitcode_ll(core::Pathname_sp filename, bool verbose, bool print, core::T_sp externalFormat );
  bool llvm_sys__load_bitcode(core::Pathname_sp filename, bool verbose, bool print, core::T_sp externalFormat );
+ bool llvm_sys__load_object_fasl(core::Pathname_sp filename, bool verbose, bool print, core::T_sp externalFormat );
 
 
 };
@@ -0,0 +1,106 @@
+/*
+    File: sourcePositionTable.h
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+ 
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+ 
+See directory 'clasp/licenses' for full details.
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+#ifndef llvmo_sourcePositionTable_H
+#define llvmo_sourcePositionTable_H
+
+#include <string>
+#include <llvm/ExecutionEngine/RuntimeDyld.h>
+#include <llvm/Object/ObjectFile.h>
+
+namespace llvmo {
+
+/*! A source position table maps code addresses to file/line/column.
+    It is one flat, immutable block of bytes that lives in its own
+    read-only mapping outside of the GC heap:
+
+      SourcePositionTableHeader
+      file names      - NUL terminated, in file index order
+      checkpoints     - a full row every SOURCE_POSITION_CHECKPOINT_INTERVAL rows
+      rows            - delta encoded: uleb address, sleb file, sleb line, uleb column
+
+    Tables for fasls are written next to the fasl when it is linked and
+    mapped from that file when it is loaded.  Code the JIT compiles gets a
+    table built from its DWARF as it is loaded.
+
+    Addresses are offsets from a base that is only known once the code is
+    loaded - the load bias of a shared library, the address of the anchor
+    symbol (CLASP_FASL_INIT_FUNCTION_NAME) less _Anchor for an object file,
+    or the first row for code the JIT loaded. */
+#define SOURCE_POSITION_TABLE_MAGIC 0x54505343 // "CSPT"
+#define SOURCE_POSITION_TABLE_VERSION 2
+#define SOURCE_POSITION_CHECKPOINT_INTERVAL 64
+#define SOURCE_POSITION_TABLE_ANCHORED 1
+
+struct SourcePositionTableHeader {
+  uint32_t _Magic;
+  uint32_t _Version;
+  uint64_t _Start;      // address of the first and the last row
+  uint64_t _End;
+  uint32_t _NumFiles;
+  uint32_t _NumRows;
+  uint32_t _NumCheckpoints;
+  uint32_t _FileNamesOffset;
+  uint32_t _CheckpointsOffset;
+  uint32_t _RowsOffset;
+  uint64_t _Size;
+  uint32_t _Flags;
+  uint32_t _Unused;
+  uint64_t _Anchor;     // address of the anchor symbol if SOURCE_POSITION_TABLE_ANCHORED
+  uint64_t _ObjectSize; // size of the fasl the table was written for
+};
+
+/*! The decoder state after a row, checkpoints store it along with the
+    offset of the next encoded row. A row with _Line == 0 ends a sequence. */
+struct SourcePositionCheckpoint {
+  uint64_t _Address;
+  uint32_t _File;
+  uint32_t _Line;
+  uint32_t _Column;
+  uint32_t _NextRowOffset;
+};
+
+/*! Build a table from the DWARF line program of a JIT-loaded object and register it */
+void register_object_source_positions(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info);
+
+/*! The file the table of FASL is stored in */
+std::string fasl_source_position_table_filename(const std::string& fasl);
+
+/*! Write the table of FASL, a shared library or an object file, next to it.
+    Returns false if FASL has no line information that could be placed. */
+bool write_fasl_source_position_table(const std::string& fasl);
+
+/*! Map the table stored next to FASL and register it.  LOAD_BIAS places the
+    table of a shared library, ANCHOR_ADDRESS the table of an object file. */
+bool map_fasl_source_position_table(const std::string& fasl, uintptr_t load_bias, uintptr_t anchor_address);
+
+/*! Look up the source position of a code address.  Allocates nothing in the
+    GC heap - the file name points into the table. */
+bool lookup_source_position(uintptr_t address, const char*& file, uint32_t& line, uint32_t& column);
+
+};
+
+#endif
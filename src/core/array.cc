@@ -28,6 +28,7 @@ THE SOFTWARE.
 
 #include <stdio.h>
 #include <string.h>
+#include <wchar.h>
 #include <clasp/core/foundation.h>
 #include <clasp/core/common.h>
 #include <clasp/core/corePackage.h>
@@ -40,6 +41,7 @@ THE SOFTWARE.
 #include <clasp/core/designators.h>
 #include <clasp/core/lispStream.h>
 #include <clasp/core/array.h>
+#include <clasp/core/bits.h>
 #include <clasp/core/character.h>
 #include <clasp/core/fli.h>
 #include <clasp/core/wrappers.h>
@@ -154,10 +156,7 @@ bool ranged_bit_vector_EQ_(const SimpleBitVector_O& bvx,const SimpleBitVector_O&
   size_t lenx = endx - startx;
   size_t leny = endy - starty;
   if (lenx!=leny) return false;
-  for (size_t ix(startx), iy(starty); ix<endx; ++ix, ++iy ) {
-    if (bvx.testBit(ix) != bvy.testBit(iy)) return false;
-  }
-  return true;
+  return bit_vector_ranges_equal(&bvx._Data[0],startx,&bvy._Data[0],starty,lenx);
 }
 
 Array_sp ranged_bit_vector_reverse(SimpleBitVector_sp sv, size_t start, size_t end) {
@@ -799,19 +798,95 @@ CL_DEFUN String_sp cl__string(T_sp arg) {
   return (result);
 };
 
+/*! char-upcase and char-downcase of every base character, so the base string
+    kernels index one 256 byte table rather than the two level unicode tables.
+    The unicode tables never map a base character outside of base-char. */
+static const unsigned char* base_char_upcase_table() {
+  static unsigned char table[256];
+  static bool initialized = [] {
+    for ( int i=0; i<256; ++i ) table[i] = static_cast<unsigned char>(claspCharacter_upcase(i));
+    return true;
+  }();
+  (void)initialized;
+  return table;
+}
+
+static const unsigned char* base_char_downcase_table() {
+  static unsigned char table[256];
+  static bool initialized = [] {
+    for ( int i=0; i<256; ++i ) table[i] = static_cast<unsigned char>(claspCharacter_downcase(i));
+    return true;
+  }();
+  (void)initialized;
+  return table;
+}
+
+template <typename C>
+inline claspCharacter string_char_upcase(C c) { return claspCharacter_upcase(static_cast<claspCharacter>(c)); }
+
+template <>
+inline claspCharacter string_char_upcase<claspChar>(claspChar c) { return base_char_upcase_table()[c]; }
+
+template <typename C>
+inline claspCharacter string_char_downcase(C c) { return claspCharacter_downcase(static_cast<claspCharacter>(c)); }
+
+template <>
+inline claspCharacter string_char_downcase<claspChar>(claspChar c) { return base_char_downcase_table()[c]; }
+
+/*! Change the case of characters START to END of STR in place */
+template <typename T1>
+void template_nstring_upcase(T1& str, size_t start, size_t end) {
+  typedef typename T1::simple_element_type CharType;
+  if (start==end) return;
+  CharType* cp = &str[start];
+  for ( size_t i(0), iEnd(end-start); i<iEnd; ++i ) cp[i] = static_cast<CharType>(string_char_upcase(cp[i]));
+}
+
+template <typename T1>
+void template_nstring_downcase(T1& str, size_t start, size_t end) {
+  typedef typename T1::simple_element_type CharType;
+  if (start==end) return;
+  CharType* cp = &str[start];
+  for ( size_t i(0), iEnd(end-start); i<iEnd; ++i ) cp[i] = static_cast<CharType>(string_char_downcase(cp[i]));
+}
+
+#define TEMPLATE_NSTRING_CASE_DISPATCHER(str,fn,start,end) \
+  if (SimpleBaseString_sp sbs = str.asOrNull<SimpleBaseString_O>()) { \
+    fn(*sbs,start,end); \
+  } else if (SimpleCharacterString_sp scs = str.asOrNull<SimpleCharacterString_O>()) { \
+    fn(*scs,start,end); \
+  } else if (Str8Ns_sp ns8 = str.asOrNull<Str8Ns_O>()) { \
+    fn(*ns8,start,end); \
+  } else { \
+    fn(*gc::As_unsafe<StrWNs_sp>(str),start,end); \
+  }
+
+SYMBOL_EXPORT_SC_(CorePkg,nstring_upcase_range);
+CL_LAMBDA(string start end);
+CL_DOCSTRING("Upcase the characters of STRING from START to END in place and return STRING");
+CL_DEFUN String_sp core__nstring_upcase_range(String_sp str, size_t start, T_sp end) {
+  size_t_pair p = sequenceStartEnd(_sym_nstring_upcase_range,str->length(),start,end);
+  TEMPLATE_NSTRING_CASE_DISPATCHER(str,template_nstring_upcase,p.start,p.end);
+  return str;
+};
+
+SYMBOL_EXPORT_SC_(CorePkg,nstring_downcase_range);
+CL_LAMBDA(string start end);
+CL_DOCSTRING("Downcase the characters of STRING from START to END in place and return STRING");
+CL_DEFUN String_sp core__nstring_downcase_range(String_sp str, size_t start, T_sp end) {
+  size_t_pair p = sequenceStartEnd(_sym_nstring_downcase_range,str->length(),start,end);
+  TEMPLATE_NSTRING_CASE_DISPATCHER(str,template_nstring_downcase,p.start,p.end);
+  return str;
+};
+
 CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("string_upcase");
 CL_DEFUN SimpleString_sp cl__string_upcase(T_sp arg) {
   String_sp str = coerce::stringDesignator(arg);
-  SimpleString_sp result = gc::As_unsafe<SimpleString_sp>(core__make_vector(str->arrayElementType(),str->length(),false));
-  for ( size_t i(0), iEnd(str->length()); i<iEnd; ++i ) {
-    T_sp cc = str->rowMajorAref(i);
-    claspCharacter c = cc.unsafe_character();
-    claspCharacter u = claspCharacter_upcase(c);
-    Character_sp cu = clasp_make_character(u);
-    result->rowMajorAset(i,clasp_make_character(u));
-  }
+  // unsafe_subseq copies into a simple string of the same element type
+  SimpleString_sp result = gc::As_unsafe<SimpleString_sp>(str->unsafe_subseq(0,str->length()));
+  TEMPLATE_NSTRING_CASE_DISPATCHER(result,template_nstring_upcase,0,result->length());
   return (result);
 };
 
@@ -821,12 +896,9 @@ CL_DECLARE();
 CL_DOCSTRING("string_downcase");
 CL_DEFUN SimpleString_sp cl__string_downcase(T_sp arg) {
   String_sp str = coerce::stringDesignator(arg);
-  SimpleString_sp result = gc::As_unsafe<SimpleString_sp>(core__make_vector(str->arrayElementType(),str->length(),false));
-  for ( size_t i(0), iEnd(str->length()); i<iEnd; ++i ) {
-    claspCharacter c = str->rowMajorAref(i).unsafe_character();
-    claspCharacter u = claspCharacter_downcase(c);
-    result->rowMajorAset(i,clasp_make_character(u));
-  }
+  // unsafe_subseq copies into a simple string of the same element type
+  SimpleString_sp result = gc::As_unsafe<SimpleString_sp>(str->unsafe_subseq(0,str->length()));
+  TEMPLATE_NSTRING_CASE_DISPATCHER(result,template_nstring_downcase,0,result->length());
   return (result);
 };
 
@@ -835,9 +907,7 @@ CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("nstring_upcase");
 CL_DEFUN String_sp cl__nstring_upcase(String_sp arg) {
-  for ( cl_index i(0), iEnd(arg->length()); i<iEnd; ++i ) {
-    arg->rowMajorAset(i,clasp_make_character(claspCharacter_upcase(arg->rowMajorAref(i).unsafe_character())));
-  }
+  TEMPLATE_NSTRING_CASE_DISPATCHER(arg,template_nstring_upcase,0,arg->length());
   return arg;
 };
 
@@ -845,9 +915,7 @@ CL_LAMBDA(arg);
 CL_DECLARE();
 CL_DOCSTRING("nstring_downcase");
 CL_DEFUN String_sp cl__nstring_downcase(String_sp arg) {
-  for ( cl_index i(0), iEnd(arg->length()); i<iEnd; ++i ) {
-    arg->rowMajorAset(i,clasp_make_character(claspCharacter_downcase(arg->rowMajorAref(i).unsafe_character())));
-  }
+  TEMPLATE_NSTRING_CASE_DISPATCHER(arg,template_nstring_downcase,0,arg->length());
   return arg;
 };
 
@@ -894,33 +962,114 @@ StringCharPointer& operator++() {
 };
 
 
+template <typename C1, typename C2>
+inline bool string_chars_equal_case_insensitive(const C1* cp1, const C2* cp2, size_t num) {
+  for ( size_t i=0; i<num; ++i ) {
+    claspCharacter c1 = static_cast<claspCharacter>(cp1[i]);
+    claspCharacter c2 = static_cast<claspCharacter>(cp2[i]);
+    if (c1 != c2 && string_char_upcase(cp1[i]) != string_char_upcase(cp2[i])) return false;
+  }
+  return true;
+}
+
+/*! Base strings compare eight characters at a time and only fold case
+    within a word that differs */
+template <>
+inline bool string_chars_equal_case_insensitive<claspChar,claspChar>(const claspChar* cp1, const claspChar* cp2, size_t num) {
+  const unsigned char* upcase = base_char_upcase_table();
+  size_t i = 0;
+  for ( ; i+sizeof(uint64_t)<=num; i+=sizeof(uint64_t) ) {
+    uint64_t w1, w2;
+    memcpy(&w1,cp1+i,sizeof(w1));
+    memcpy(&w2,cp2+i,sizeof(w2));
+    if (w1 == w2) continue;
+    for ( size_t j=i; j<i+sizeof(uint64_t); ++j ) {
+      if (upcase[cp1[j]] != upcase[cp2[j]]) return false;
+    }
+  }
+  for ( ; i<num; ++i ) {
+    if (upcase[cp1[i]] != upcase[cp2[i]]) return false;
+  }
+  return true;
+}
+
+/*! Return a pointer to the first C in [cp,cpe) or NULL.  Base strings use
+    memchr and character strings wmemchr, which scan a vector register at a time. */
+template <typename C>
+inline const C* string_find_char(const C* cp, const C* cpe, C c) {
+  for ( ; cp<cpe; ++cp ) if (*cp == c) return cp;
+  return NULL;
+}
+
+template <>
+inline const claspChar* string_find_char<claspChar>(const claspChar* cp, const claspChar* cpe, claspChar c) {
+  return static_cast<const claspChar*>(memchr(cp,c,cpe-cp));
+}
+
+template <>
+inline const claspCharacter* string_find_char<claspCharacter>(const claspCharacter* cp, const claspCharacter* cpe, claspCharacter c) {
+  if (sizeof(wchar_t) == sizeof(claspCharacter)) {
+    return reinterpret_cast<const claspCharacter*>(wmemchr(reinterpret_cast<const wchar_t*>(cp),static_cast<wchar_t>(c),cpe-cp));
+  }
+  for ( ; cp<cpe; ++cp ) if (*cp == c) return cp;
+  return NULL;
+}
+
+/*! Return a pointer to the last C in [cp,cpe) or NULL */
+template <typename C>
+inline const C* string_find_char_from_end(const C* cp, const C* cpe, C c) {
+  while (cpe>cp) if (*--cpe == c) return cpe;
+  return NULL;
+}
+
+#ifdef _TARGET_OS_LINUX
+template <>
+inline const claspChar* string_find_char_from_end<claspChar>(const claspChar* cp, const claspChar* cpe, claspChar c) {
+  return static_cast<const claspChar*>(memrchr(cp,c,cpe-cp));
+}
+#endif
+
+/*! Return a pointer to the first occurrence of SUB in OUTER or NULL.
+    Candidates are found by scanning for the first character of SUB. */
+template <typename C1, typename C2>
+const C2* string_search_chars(const C1* sub, size_t sub_num, const C2* outer, size_t outer_num) {
+  if (sub_num == 0) return outer;
+  if (sub_num > outer_num) return NULL;
+  C2 first = static_cast<C2>(sub[0]);
+  // A character of SUB that doesn't fit in OUTER can never match
+  if (static_cast<claspCharacter>(first) != static_cast<claspCharacter>(sub[0])) return NULL;
+  const C2* last = outer + (outer_num - sub_num) + 1;
+  for ( const C2* cp = outer; (cp = string_find_char(cp,last,first)); ++cp ) {
+    if (string_chars_equal(sub+1,cp+1,sub_num-1)) return cp;
+  }
+  return NULL;
+}
+
+/*! Base strings use memmem, which is linear time (Two-Way) in glibc */
+template <>
+const claspChar* string_search_chars<claspChar,claspChar>(const claspChar* sub, size_t sub_num, const claspChar* outer, size_t outer_num) {
+  return static_cast<const claspChar*>(memmem(outer,outer_num,sub,sub_num));
+}
+
+template <typename C1, typename C2>
+const C2* string_search_chars_case_insensitive(const C1* sub, size_t sub_num, const C2* outer, size_t outer_num) {
+  if (sub_num == 0) return outer;
+  if (sub_num > outer_num) return NULL;
+  claspCharacter first = string_char_upcase(sub[0]);
+  const C2* last = outer + (outer_num - sub_num) + 1;
+  for ( const C2* cp = outer; cp<last; ++cp ) {
+    if (string_char_upcase(*cp) == first &&
+        string_chars_equal_case_insensitive(sub+1,cp+1,sub_num-1)) return cp;
+  }
+  return NULL;
+}
+
 template <typename T1, typename T2>
 bool template_string_equalp_bool(const T1& string1, const T2& string2, size_t start1, size_t end1, size_t start2, size_t end2) {
-  StringCharPointer<T1> cp1(&string1,start1);
-  StringCharPointer<T2> cp2(&string2,start2);
   size_t num1 = end1 - start1;
   size_t num2 = end2 - start2;
-  while (1) {
-    if (num1 == 0)
-      goto END_STRING1;
-    if (num2 == 0)
-      goto END_STRING2;
-    if ((toupper(static_cast<claspCharacter>(*cp1)) != toupper(static_cast<claspCharacter>(*cp2))))
-      goto RETURN_FALSE;
-    --num1;
-    --num2;
-    ++cp1;
-    ++cp2;
-  }
- END_STRING1:
-  if (num2 == 0)
-    goto RETURN_TRUE;
-  goto RETURN_FALSE;
- END_STRING2:
- RETURN_FALSE:
-  return false;
- RETURN_TRUE:
-  return true;
+  if (num1 != num2) return false;
+  return string_chars_equal_case_insensitive(&string1[start1],&string2[start2],num1);
 }
 
 
@@ -930,31 +1079,8 @@ bool template_string_equalp_bool(const T1& string1, const T2& string2, size_t st
 template <typename T1,typename T2>
 T_sp template_string_EQ_(const T1& string1, const T2& string2, size_t start1, size_t end1, size_t start2, size_t end2)
 {
-  StringCharPointer<T1> cp1(&string1,start1);
-  StringCharPointer<T2> cp2(&string2,start2);
-  size_t num1 = end1 - start1;
-  size_t num2 = end2 - start2;
-  while (1) {
-    if (num1 == 0)
-      goto END_STRING1;
-    if (num2 == 0)
-      goto END_STRING2;
-    if ((static_cast<claspCharacter>(*cp1) != static_cast<claspCharacter>(*cp2)))
-      goto RETURN_FALSE;
-    --num1;
-    --num2;
-    ++cp1;
-    ++cp2;
-  }
- END_STRING1:
-  if (num2 == 0)
-    goto RETURN_TRUE;
-  goto RETURN_FALSE;
- END_STRING2:
- RETURN_FALSE:
+  if (template_string_EQ_equal(string1,string2,start1,end1,start2,end2)) return _lisp->_true();
   return _Nil<T_O>();
- RETURN_TRUE:
-  return _lisp->_true();
 }
 
 /*! bounding index designator range from 0 to the end of each string */
@@ -1123,31 +1249,8 @@ T_sp template_string_GE_(const T1& string1, const T2& string2, size_t start1, si
 /*! bounding index designator range from 0 to the end of each string */
 template <typename T1, typename T2>
 T_sp template_string_equal(const T1& string1, const T2& string2, size_t start1, size_t end1, size_t start2, size_t end2) {
-  StringCharPointer<T1> cp1(&string1,start1);
-  StringCharPointer<T2> cp2(&string2,start2);
-  size_t num1 = end1 - start1;
-  size_t num2 = end2 - start2;
-  while (1) {
-    if (num1 == 0)
-      goto END_STRING1;
-    if (num2 == 0)
-      goto END_STRING2;
-    if ((toupper(static_cast<claspCharacter>(*cp1)) != toupper(static_cast<claspCharacter>(*cp2))))
-      goto RETURN_FALSE;
-    --num1;
-    --num2;
-    ++cp1;
-    ++cp2;
-  }
- END_STRING1:
-  if (num2 == 0)
-    goto RETURN_TRUE;
-  goto RETURN_FALSE;
- END_STRING2:
- RETURN_FALSE:
+  if (template_string_equalp_bool(string1,string2,start1,end1,start2,end2)) return _lisp->_true();
   return _Nil<T_O>();
- RETURN_TRUE:
-  return _lisp->_true();
 }
 
 /*! bounding index designator range from 0 to the end of each string */
@@ -1162,7 +1265,7 @@ T_sp template_string_not_equal(const T1& string1, const T2& string2, size_t star
       goto END_STRING1;
     if (num2 == 0)
       goto END_STRING2;
-    if ((toupper(static_cast<claspCharacter>(*cp1)) != toupper(static_cast<claspCharacter>(*cp2))))
+    if ((string_char_upcase(*cp1) != string_char_upcase(*cp2)))
       goto RETURN_TRUE;
     --num1;
     --num2;
@@ -1192,8 +1295,8 @@ T_sp template_string_lessp(const T1& string1, const T2& string2, size_t start1,
       goto END_STRING1;
     if (num2 == 0)
       goto END_STRING2;
-    claspCharacter ucp1 = toupper(static_cast<claspCharacter>(*cp1));
-    claspCharacter ucp2 = toupper(static_cast<claspCharacter>(*cp2));
+    claspCharacter ucp1 = string_char_upcase(*cp1);
+    claspCharacter ucp2 = string_char_upcase(*cp2);
     if (ucp1 != ucp2) {
       if (ucp1 < ucp2)
         goto RETURN_TRUE;
@@ -1226,8 +1329,8 @@ T_sp template_string_greaterp(const T1& string1, const T2& string2, size_t start
       goto END_STRING1;
     if (num2 == 0)
       goto END_STRING2;
-    claspCharacter ucp1 = toupper(static_cast<claspCharacter>(*cp1));
-    claspCharacter ucp2 = toupper(static_cast<claspCharacter>(*cp2));
+    claspCharacter ucp1 = string_char_upcase(*cp1);
+    claspCharacter ucp2 = string_char_upcase(*cp2);
     if ((ucp1 != ucp2)) {
       if (ucp1 > ucp2)
         goto RETURN_TRUE;
@@ -1260,8 +1363,8 @@ T_sp template_string_not_greaterp(const T1& string1, const T2& string2, size_t s
       goto END_STRING1;
     if (num2 == 0)
       goto END_STRING2;
-    claspCharacter ucp1 = toupper(static_cast<claspCharacter>(*cp1));
-    claspCharacter ucp2 = toupper(static_cast<claspCharacter>(*cp2));
+    claspCharacter ucp1 = string_char_upcase(*cp1);
+    claspCharacter ucp2 = string_char_upcase(*cp2);
     if ((ucp1 != ucp2)) {
       if (ucp1 < ucp2)
         goto RETURN_TRUE;
@@ -1296,8 +1399,8 @@ T_sp template_string_not_lessp(const T1& string1, const T2& string2, size_t star
       goto END_STRING1;
     if (num2 == 0)
       goto END_STRING2;
-    claspCharacter ucp1 = toupper(static_cast<claspCharacter>(*cp1));
-    claspCharacter ucp2 = toupper(static_cast<claspCharacter>(*cp2));
+    claspCharacter ucp1 = string_char_upcase(*cp1);
+    claspCharacter ucp2 = string_char_upcase(*cp2);
     if ((ucp1 != ucp2)) {
       if (ucp1 > ucp2)
         goto RETURN_TRUE;
@@ -2979,16 +3082,19 @@ CL_DEFUN T_sp core__base_string_concatenate(VaList_sp vargs) {
 template <typename T1,typename T2>
 T_sp template_search_string(const T1& sub, const T2& outer, size_t sub_start, size_t sub_end, size_t outer_start, size_t outer_end)
 {
-  // The std::search convention is reversed -->  std::search(outer,sub,...)
   const typename T2::simple_element_type* startp = &outer[0];
-  const typename T2::simple_element_type* cps = &outer[outer_start];
-  const typename T2::simple_element_type* cpe = &outer[outer_end];
-  const typename T1::simple_element_type* s_cps = &sub[sub_start];
-  const typename T1::simple_element_type* s_cpe = &sub[sub_end];
-  const typename T2::simple_element_type* pos = std::search(cps,cpe,s_cps,s_cpe);
-  if (pos == cpe ) return _Nil<T_O>();
+  const typename T2::simple_element_type* pos = string_search_chars(&sub[sub_start],sub_end-sub_start,&outer[outer_start],outer_end-outer_start);
+  if (!pos) return _Nil<T_O>();
   // this should return the absolute position starting from 0, not relative to outer_start
-  //now that I understood this in pointer arithmethic, compare to the beginning of the string, e.g. index 0
+  return clasp_make_fixnum(pos-startp);
+}
+
+template <typename T1,typename T2>
+T_sp template_search_string_equal(const T1& sub, const T2& outer, size_t sub_start, size_t sub_end, size_t outer_start, size_t outer_end)
+{
+  const typename T2::simple_element_type* startp = &outer[0];
+  const typename T2::simple_element_type* pos = string_search_chars_case_insensitive(&sub[sub_start],sub_end-sub_start,&outer[outer_start],outer_end-outer_start);
+  if (!pos) return _Nil<T_O>();
   return clasp_make_fixnum(pos-startp);
 }
 
@@ -3001,6 +3107,46 @@ CL_DEFUN T_sp core__search_string(String_sp sub, size_t sub_start, T_sp sub_end,
   TEMPLATE_STRING_DISPATCHER(sub,outer,template_search_string,psub.start,psub.end,pouter.start,pouter.end);
 };
 
+SYMBOL_EXPORT_SC_(CorePkg,search_string_equal);
+CL_LAMBDA(sub sub_start sub_end outer outer_start outer_end);
+CL_DOCSTRING("search for the first occurance of sub in outer ignoring case, like search with :test #'char-equal");
+CL_DEFUN T_sp core__search_string_equal(String_sp sub, size_t sub_start, T_sp sub_end, String_sp outer, size_t outer_start, T_sp outer_end) {
+  size_t_pair psub = sequenceStartEnd(_sym_search_string_equal,sub->length(),sub_start,sub_end);
+  size_t_pair pouter = sequenceStartEnd(_sym_search_string_equal,outer->length(),outer_start,outer_end);
+  TEMPLATE_STRING_DISPATCHER(sub,outer,template_search_string_equal,psub.start,psub.end,pouter.start,pouter.end);
+};
+
+template <typename T1>
+T_sp template_string_position_char(const T1& str, claspCharacter c, size_t start, size_t end, bool from_end)
+{
+  typedef typename T1::simple_element_type CharType;
+  CharType cc = static_cast<CharType>(c);
+  // A character that doesn't fit in the string can't be in it
+  if (static_cast<claspCharacter>(cc) != c) return _Nil<T_O>();
+  const CharType* startp = &str[0];
+  const CharType* pos = from_end
+    ? string_find_char_from_end(&str[start],&str[end],cc)
+    : string_find_char(&str[start],&str[end],cc);
+  if (!pos) return _Nil<T_O>();
+  return clasp_make_fixnum(pos-startp);
+}
+
+SYMBOL_EXPORT_SC_(CorePkg,string_position_char);
+CL_LAMBDA(char string start end from-end);
+CL_DOCSTRING("Return the index of the first (last if FROM-END) CHAR in STRING between START and END or NIL, scanning with memchr");
+CL_DEFUN T_sp core__string_position_char(Character_sp ch, String_sp str, size_t start, T_sp end, bool from_end) {
+  size_t_pair p = sequenceStartEnd(_sym_string_position_char,str->length(),start,end);
+  claspCharacter c = ch.unsafe_character();
+  if (SimpleBaseString_sp sbs = str.asOrNull<SimpleBaseString_O>()) {
+    return template_string_position_char(*sbs,c,p.start,p.end,from_end);
+  } else if (SimpleCharacterString_sp scs = str.asOrNull<SimpleCharacterString_O>()) {
+    return template_string_position_char(*scs,c,p.start,p.end,from_end);
+  } else if (Str8Ns_sp ns8 = str.asOrNull<Str8Ns_O>()) {
+    return template_string_position_char(*ns8,c,p.start,p.end,from_end);
+  }
+  return template_string_position_char(*gc::As_unsafe<StrWNs_sp>(str),c,p.start,p.end,from_end);
+};
+
 
 CL_LISPIFY_NAME("core:split");
 CL_DEFUN List_sp core__split(const string& all, const string &chars) {
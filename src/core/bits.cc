@@ -465,6 +465,104 @@ inline void store_byte32(Pointer pointer, Index index, Offset offset, Value valu
   set_high32((pointer)[(index)+1], offset, (value) << (32 - (offset)));
 }
 
+template <int OP> struct do_bit_op {};
+template <> struct do_bit_op<b_clr_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_clr_op(i,j); };};
+template <> struct do_bit_op<and_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return and_op(i,j);};};
+template <> struct do_bit_op<andc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc2_op(i,j);};};
+template <> struct do_bit_op<b_1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_1_op(i,j);};};
+template <> struct do_bit_op<andc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc1_op(i,j);};};
+template <> struct do_bit_op<b_2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_2_op(i,j);};};
+template <> struct do_bit_op<xor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return xor_op(i,j);};};
+template <> struct do_bit_op<ior_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return ior_op(i,j);};};
+template <> struct do_bit_op<nor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nor_op(i,j);};};
+template <> struct do_bit_op<eqv_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return eqv_op(i,j);};};
+template <> struct do_bit_op<b_c2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c2_op(i,j);};};
+template <> struct do_bit_op<orc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc2_op(i,j);};};
+template <> struct do_bit_op<b_c1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c1_op(i,j);};};
+template <> struct do_bit_op<orc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc1_op(i,j);};};
+template <> struct do_bit_op<nand_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nand_op(i,j);};};
+template <> struct do_bit_op<b_set_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_set_op(i,j);};};
+
+/*! Apply OP to NWORDS word aligned words.  Pairs of words are processed as
+    64 bit words and the loop has no calls in it so that it can be vectorized. */
+template <int OP>
+static void bit_array_op_words(byte32_t* rp, const byte32_t* xp, const byte32_t* yp, size_t nwords) {
+  size_t i = 0;
+  for ( ; i+2 <= nwords; i += 2 ) {
+    byte64_t xi, yi, ri;
+    memcpy(&xi,xp+i,sizeof(xi));
+    memcpy(&yi,yp+i,sizeof(yi));
+    ri = do_bit_op<OP>::do_it(xi,yi);
+    memcpy(rp+i,&ri,sizeof(ri));
+  }
+  for ( ; i<nwords; ++i ) {
+    rp[i] = do_bit_op<OP>::do_it(xp[i],yp[i]);
+  }
+}
+
+/*! Apply OP to D bits starting at arbitrary bit offsets by shifting each word into place */
+template <int OP>
+static void bit_array_op_unaligned(byte32_t* rp, size_t ro, const byte32_t* xp, size_t xo, const byte32_t* yp, size_t yo, gctools::Fixnum d) {
+  gctools::Fixnum i, j, n;
+  byte64_t xi, yi, ri;
+  // extract_byte32/store_byte32 expect offsets within a word
+  xp += xo/32; xo %= 32;
+  yp += yo/32; yo %= 32;
+  rp += ro/32; ro %= 32;
+  for (n = d / 32, i = 0; i <= n; i++) {
+    extract_byte32(xi, xp, i, xo);
+    extract_byte32(yi, yp, i, yo);
+    if (i == n) {
+      if ((j = d % 32) == 0)
+        break;
+      extract_byte32(ri, rp, n, ro);
+      set_high32(ri, j, do_bit_op<OP>::do_it(xi, yi));
+    } else {
+      ri = do_bit_op<OP>::do_it(xi, yi);
+    }
+    store_byte32(rp, i, ro, ri);
+  }
+}
+
+typedef void (*bit_words_operator)(byte32_t*, const byte32_t*, const byte32_t*, size_t);
+typedef void (*bit_unaligned_operator)(byte32_t*, size_t, const byte32_t*, size_t, const byte32_t*, size_t, gctools::Fixnum);
+
+static bit_words_operator bit_words_operations[boolOpsMax] = {
+    bit_array_op_words<b_clr_op_id>,
+    bit_array_op_words<and_op_id>,
+    bit_array_op_words<andc2_op_id>,
+    bit_array_op_words<b_1_op_id>,
+    bit_array_op_words<andc1_op_id>,
+    bit_array_op_words<b_2_op_id>,
+    bit_array_op_words<xor_op_id>,
+    bit_array_op_words<ior_op_id>,
+    bit_array_op_words<nor_op_id>,
+    bit_array_op_words<eqv_op_id>,
+    bit_array_op_words<b_c2_op_id>,
+    bit_array_op_words<orc2_op_id>,
+    bit_array_op_words<b_c1_op_id>,
+    bit_array_op_words<orc1_op_id>,
+    bit_array_op_words<nand_op_id>,
+    bit_array_op_words<b_set_op_id>};
+
+static bit_unaligned_operator bit_unaligned_operations[boolOpsMax] = {
+    bit_array_op_unaligned<b_clr_op_id>,
+    bit_array_op_unaligned<and_op_id>,
+    bit_array_op_unaligned<andc2_op_id>,
+    bit_array_op_unaligned<b_1_op_id>,
+    bit_array_op_unaligned<andc1_op_id>,
+    bit_array_op_unaligned<b_2_op_id>,
+    bit_array_op_unaligned<xor_op_id>,
+    bit_array_op_unaligned<ior_op_id>,
+    bit_array_op_unaligned<nor_op_id>,
+    bit_array_op_unaligned<eqv_op_id>,
+    bit_array_op_unaligned<b_c2_op_id>,
+    bit_array_op_unaligned<orc2_op_id>,
+    bit_array_op_unaligned<b_c1_op_id>,
+    bit_array_op_unaligned<orc1_op_id>,
+    bit_array_op_unaligned<nand_op_id>,
+    bit_array_op_unaligned<b_set_op_id>};
+
 //#define TEMPLATE_BIT_ARRAY_OP 1
 #ifndef TEMPLATE_BIT_ARRAY_OP
 
@@ -508,7 +606,7 @@ CL_DEFUN T_sp core__bit_array_op(int opval, Array_sp tx, Array_sp ty, T_sp tr) {
   size_t startr0 = 0;
   bit_operator op;
   bool replace = false;
-  byte64_t xi, yi, ri;
+  byte64_t ri;
   byte32_t *xp, *yp, *rp;
   byte64_t xo, yo, ro;
   AbstractSimpleVector_sp ax;
@@ -567,13 +665,14 @@ L1:
   }
   rp = r->bytes();
   ro = startr; // r->offset();
+  if (opval < 0 || opval >= boolOpsMax)
+    goto ERROR;
   op = fixnum_operations[opval];
 
   //
   if (xo == 0 && yo == 0 && ro == 0) {
-    for (n = d / 32, i = 0; i < n; i++) {
-      rp[i] = (*op)(xp[i], yp[i]);
-    }
+    n = d / 32;
+    bit_words_operations[opval](rp, xp, yp, n);
     if ((j = d % 32) > 0) {
       byte64_t rpt = (*op)(xp[n], yp[n]);
       set_high32(rp[n], j, rpt);
@@ -581,24 +680,12 @@ L1:
     if (!replace)
       return dispatcher.dispatcher(&(* tx),r);
   } else {
-    for (n = d / 32, i = 0; i <= n; i++) {
-      extract_byte32(xi, xp, i, xo);
-      extract_byte32(yi, yp, i, yo);
-      if (i == n) {
-        if ((j = d % 32) == 0)
-          break;
-        extract_byte32(ri, rp, n, ro);
-        set_high32(ri, j, (*op)(xi, yi));
-      } else {
-        ri = (*op)(xi, yi);
-      }
-      store_byte32(rp, i, ro, ri);
-    }
+    bit_unaligned_operations[opval](rp, ro, xp, xo, yp, yo, d);
     if (!replace)
       return dispatcher.dispatcher(&(* tx),r);
   }
-  rp = r0->bytes();
-  ro = startr0; // r0->offset();
+  rp = r0->bytes() + startr0/32;
+  ro = startr0 % 32; // r0->offset();
   for (n = d / 32, i = 0; i <= n; i++) {
     if (i == n) {
       if ((j = d % 32) == 0)
@@ -634,24 +721,6 @@ CL_DEFUN T_sp core__bit_array_op_nand_op(T_sp tx, T_sp ty, T_sp tr) { return cor
 CL_DEFUN T_sp core__bit_array_op_b_set_op(T_sp tx, T_sp ty, T_sp tr) { return core__bit_array_op(b_set_op_id,UA(tx),UA(ty),tr); };
 
 #else
-template <int OP> struct do_bit_op {};
-template <> struct do_bit_op<b_clr_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_clr_op(i,j); };};
-template <> struct do_bit_op<and_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return and_op(i,j);};};
-template <> struct do_bit_op<andc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc2_op(i,j);};};
-template <> struct do_bit_op<b_1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_1_op(i,j);};};
-template <> struct do_bit_op<andc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return andc1_op(i,j);};};
-template <> struct do_bit_op<b_2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_2_op(i,j);};};
-template <> struct do_bit_op<xor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return xor_op(i,j);};};
-template <> struct do_bit_op<ior_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return ior_op(i,j);};};
-template <> struct do_bit_op<nor_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nor_op(i,j);};};
-template <> struct do_bit_op<eqv_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return eqv_op(i,j);};};
-template <> struct do_bit_op<b_c2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c2_op(i,j);};};
-template <> struct do_bit_op<orc2_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc2_op(i,j);};};
-template <> struct do_bit_op<b_c1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_c1_op(i,j);};};
-template <> struct do_bit_op<orc1_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return orc1_op(i,j);};};
-template <> struct do_bit_op<nand_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return nand_op(i,j);};};
-template <> struct do_bit_op<b_set_op_id> {static gc::Fixnum do_it(gc::Fixnum i, gc::Fixnum j) { return b_set_op(i,j);};};
-
 template <int OP>
 T_sp template_bit_array_op(T_sp tx, T_sp ty, T_sp tr) {
   gctools::Fixnum i, j, n, d;
@@ -780,6 +849,158 @@ CL_DEFUN T_sp core__bit_array_op_b_set_op(T_sp tx, T_sp ty, T_sp tr) { return te
 
 #endif
 #endif
+
+/*
+ * WORD AT A TIME BIT VECTOR SCANNING
+ *
+ * Bits are stored most significant bit first within each word so the first
+ * bit of a range is found with a count of leading zeros and the last with a
+ * count of trailing zeros.
+ */
+
+typedef SimpleBitVector_O::value_type bit_word_t;
+static const size_t bit_word_bits = sizeof(bit_word_t)*CHAR_BIT;
+static const size_t bit_words_per_64 = sizeof(byte64_t)/sizeof(bit_word_t);
+static const bit_word_t bit_word_ones = std::numeric_limits<bit_word_t>::max();
+
+/*! Mask selecting the bits at positions [start,end) of a word, 0 <= start < end <= bit_word_bits */
+inline bit_word_t bit_word_range_mask(size_t start, size_t end) {
+  bit_word_t head = (bit_word_t)(bit_word_ones >> start);
+  bit_word_t tail = (end == bit_word_bits) ? bit_word_ones : (bit_word_t)~(bit_word_t)(bit_word_ones >> end);
+  return head & tail;
+}
+
+inline size_t bit_word_leading_zeros(bit_word_t word) {
+  return __builtin_clzll((byte64_t)word) - (64 - bit_word_bits);
+}
+
+inline size_t bit_word_trailing_zeros(bit_word_t word) {
+  return __builtin_ctzll((byte64_t)word);
+}
+
+/*! Count the 1 bits in [start,end) of the bit data */
+size_t bit_vector_count_ones(const bit_word_t* data, size_t start, size_t end) {
+  if (start >= end) return 0;
+  size_t first = start / bit_word_bits;
+  size_t last = (end - 1) / bit_word_bits;
+  size_t head = start % bit_word_bits;
+  size_t tail = (end - 1) % bit_word_bits + 1;
+  if (first == last) return __builtin_popcountll(data[first] & bit_word_range_mask(head, tail));
+  size_t count = __builtin_popcountll(data[first] & bit_word_range_mask(head, bit_word_bits));
+  size_t i = first + 1;
+  for ( ; i + bit_words_per_64 <= last; i += bit_words_per_64 ) {
+    byte64_t word;
+    memcpy(&word, data + i, sizeof(word));
+    count += __builtin_popcountll(word);
+  }
+  for ( ; i < last; ++i ) count += __builtin_popcountll(data[i]);
+  count += __builtin_popcountll(data[last] & bit_word_range_mask(0, tail));
+  return count;
+}
+
+/*! Return the index of the first (or last if FROM_END) bit in [start,end) that is equal to BIT
+    or -1 if there is none */
+gctools::Fixnum bit_vector_position(const bit_word_t* data, size_t start, size_t end, uint bit, bool from_end) {
+  if (start >= end) return -1;
+  // Look for set bits in WORD - invert the words when looking for a clear bit
+  bit_word_t flip = bit ? 0 : bit_word_ones;
+  size_t first = start / bit_word_bits;
+  size_t last = (end - 1) / bit_word_bits;
+  size_t head = start % bit_word_bits;
+  size_t tail = (end - 1) % bit_word_bits + 1;
+  if (!from_end) {
+    for ( size_t i = first; i <= last; ++i ) {
+      // Skip runs of words without a match 64 bits at a time
+      if (i != first) {
+        byte64_t flip64 = bit ? 0 : ~(byte64_t)0;
+        while (i + bit_words_per_64 <= last) {
+          byte64_t word;
+          memcpy(&word, data + i, sizeof(word));
+          if (word ^ flip64) break;
+          i += bit_words_per_64;
+        }
+      }
+      bit_word_t word = (bit_word_t)(data[i] ^ flip);
+      if (i == first) word &= bit_word_range_mask(head, bit_word_bits);
+      if (i == last) word &= bit_word_range_mask(0, tail);
+      if (word) return i * bit_word_bits + bit_word_leading_zeros(word);
+    }
+  } else {
+    for ( size_t i = last + 1; i-- > first; ) {
+      bit_word_t word = (bit_word_t)(data[i] ^ flip);
+      if (i == first) word &= bit_word_range_mask(head, bit_word_bits);
+      if (i == last) word &= bit_word_range_mask(0, tail);
+      if (word) return i * bit_word_bits + (bit_word_bits - 1 - bit_word_trailing_zeros(word));
+    }
+  }
+  return -1;
+}
+
+/*! Compare LEN bits of X starting at STARTX with bits of Y starting at STARTY.
+    When both ranges start at the same offset within a word the whole words
+    in between are compared with memcmp. */
+bool bit_vector_ranges_equal(const bit_word_t* x, size_t startx, const bit_word_t* y, size_t starty, size_t len) {
+  if (len == 0) return true;
+  if ((startx % bit_word_bits) != (starty % bit_word_bits)) {
+    for ( size_t i = 0; i < len; ++i ) {
+      size_t ix = startx + i, iy = starty + i;
+      bool bx = (x[ix / bit_word_bits] >> (bit_word_bits - 1 - ix % bit_word_bits)) & 1;
+      bool by = (y[iy / bit_word_bits] >> (bit_word_bits - 1 - iy % bit_word_bits)) & 1;
+      if (bx != by) return false;
+    }
+    return true;
+  }
+  x += startx / bit_word_bits;
+  y += starty / bit_word_bits;
+  size_t head = startx % bit_word_bits;
+  size_t end = head + len;
+  size_t last = (end - 1) / bit_word_bits;
+  size_t tail = (end - 1) % bit_word_bits + 1;
+  if (last == 0) {
+    bit_word_t mask = bit_word_range_mask(head, tail);
+    return (x[0] & mask) == (y[0] & mask);
+  }
+  bit_word_t mask = bit_word_range_mask(head, bit_word_bits);
+  if ((x[0] & mask) != (y[0] & mask)) return false;
+  if (last > 1 && memcmp(x + 1, y + 1, (last - 1) * sizeof(bit_word_t)) != 0) return false;
+  mask = bit_word_range_mask(0, tail);
+  return (x[last] & mask) == (y[last] & mask);
+}
+
+/*! Return the underlying bit data and range of a bit vector */
+static SimpleBitVector_sp bit_vector_data_range(T_sp bit_vector, size_t start, T_sp end, size_t& data_start, size_t& data_end) {
+  AbstractSimpleVector_sp sv;
+  size_t sv_start, sv_end;
+  gc::As<Array_sp>(bit_vector)->asAbstractSimpleVectorRange(sv, sv_start, sv_end);
+  if (!gc::IsA<SimpleBitVector_sp>(sv)) TYPE_ERROR(bit_vector, cl::_sym_bit_vector);
+  size_t length = sv_end - sv_start;
+  size_t iend = end.nilp() ? length : clasp_to_size(end);
+  if (iend > length) SIMPLE_ERROR(BF("The end %lu is beyond the length %lu of %s") % iend % length % _rep_(bit_vector));
+  if (start > iend) SIMPLE_ERROR(BF("The start %lu is beyond the end %lu for %s") % start % iend % _rep_(bit_vector));
+  data_start = sv_start + start;
+  data_end = sv_start + iend;
+  return gc::As_unsafe<SimpleBitVector_sp>(sv);
+}
+
+CL_LAMBDA(bit-vector bit &optional (start 0) end);
+CL_DOCSTRING("Count the elements of BIT-VECTOR between START and END that are equal to BIT using population counts of whole words.");
+CL_DEFUN size_t core__bit_vector_count(T_sp bit_vector, uint bit, size_t start, T_sp end) {
+  size_t data_start, data_end;
+  SimpleBitVector_sp sbv = bit_vector_data_range(bit_vector, start, end, data_start, data_end);
+  size_t ones = bit_vector_count_ones(sbv->bytes(), data_start, data_end);
+  return bit ? ones : (data_end - data_start) - ones;
+}
+
+CL_LAMBDA(bit-vector bit &optional (start 0) end from-end);
+CL_DOCSTRING("Return the index of the first (last if FROM-END) element of BIT-VECTOR between START and END that is equal to BIT or NIL. Whole words without a match are skipped.");
+CL_DEFUN T_sp core__bit_vector_position(T_sp bit_vector, uint bit, size_t start, T_sp end, bool from_end) {
+  size_t data_start, data_end;
+  SimpleBitVector_sp sbv = bit_vector_data_range(bit_vector, start, end, data_start, data_end);
+  gctools::Fixnum pos = bit_vector_position(sbv->bytes(), data_start, data_end, bit, from_end);
+  if (pos < 0) return _Nil<T_O>();
+  return clasp_make_fixnum(pos - (data_start - start));
+}
+
 /*! Copied from ECL */
 CL_DEFUN T_sp cl__logbitp(Integer_sp p, Integer_sp x) {
   // Arguments and Values:p - a non-negative integer,  x - an integer.
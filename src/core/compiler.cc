@@ -30,6 +30,9 @@ THE SOFTWARE.
 //#define DEBUG_LEVEL_FULL
 
 #include <dlfcn.h>
+#if defined(_TARGET_OS_LINUX) || defined(_TARGET_OS_FREEBSD)
+#include <link.h>
+#endif
 #ifdef _TARGET_OS_DARWIN
 #import <mach-o/dyld.h>
 #endif
@@ -69,6 +72,7 @@ THE SOFTWARE.
 #include <clasp/core/pointer.h>
 #include <clasp/core/environment.h>
 #include <clasp/llvmo/intrinsics.h>
+#include <clasp/llvmo/sourcePositionTable.h>
 #include <clasp/core/wrappers.h>
 
 
@@ -532,6 +536,34 @@ CL_DEFUN T_sp core__startup_image_pathname(char stage) {
   return pn;
 };
 
+/*! Return true if the file starts with the LLVM bitcode magic number */
+static bool bitcode_file_p(const string& name) {
+  unsigned char magic[4];
+  FILE* fin = fopen(name.c_str(),"r");
+  if (!fin) return false;
+  size_t read = fread(magic,1,sizeof(magic),fin);
+  fclose(fin);
+  return read == sizeof(magic) && magic[0] == 'B' && magic[1] == 'C' && magic[2] == 0xC0 && magic[3] == 0xDE;
+}
+
+/*! Return true if the file is a relocatable ELF or Mach-O object - a fasl
+    that was linked in process rather than into a shared library */
+static bool object_file_p(const string& name) {
+  unsigned char header[18];
+  FILE* fin = fopen(name.c_str(),"r");
+  if (!fin) return false;
+  size_t read = fread(header,1,sizeof(header),fin);
+  fclose(fin);
+  if (read < sizeof(header)) return false;
+  if (header[0] == 0x7F && header[1] == 'E' && header[2] == 'L' && header[3] == 'F') {
+    return header[16] == 1 && header[17] == 0; // e_type ET_REL
+  }
+  if (header[0] == 0xCF && header[1] == 0xFA && header[2] == 0xED && header[3] == 0xFE) {
+    return header[12] == 1 && header[13] == 0; // filetype MH_OBJECT
+  }
+  return false;
+}
+
 CL_LAMBDA(name &optional verbose print external-format);
 CL_DECLARE();
 CL_DOCSTRING("load-binary");
@@ -563,6 +595,16 @@ CL_DEFUN T_mv core__load_binary(T_sp pathDesig, T_sp verbose, T_sp print, T_sp e
 LOAD:
   String_sp nameStr = gc::As<String_sp>(cl__namestring(cl__probe_file(path)));
   string name = nameStr->get();
+  if (object_file_p(name)) {
+    // Linked in process (see cmp::*link-fasls-in-process*) - the JIT only links it
+    T_sp loaded = eval::funcall(llvmo::_sym_load_object_fasl, path, verbose, print, external_format);
+    return Values(loaded, _Nil<T_O>());
+  }
+  if (bitcode_file_p(name)) {
+    // An older in process fasl that still holds bitcode - the JIT compiles it
+    T_sp loaded = eval::funcall(llvmo::_sym_load_bitcode, path, verbose, print, external_format);
+    return Values(loaded, _Nil<T_O>());
+  }
 
   /* Look up the initialization function. */
   string stem = cl__string_downcase(gc::As<String_sp>(path->_Name))->get();
@@ -583,6 +625,13 @@ LOAD:
     //    return (Values(_Nil<T_O>(), SimpleBaseString_O::make(error)));
   }
   add_dynamic_library_using_handle(name,handle);
+#if defined(_TARGET_OS_LINUX) || defined(_TARGET_OS_FREEBSD)
+  // Map the source position table written when the fasl was linked
+  struct link_map* link_map;
+  if (dlinfo(handle, RTLD_DI_LINKMAP, &link_map) == 0) {
+    llvmo::map_fasl_source_position_table(name, (uintptr_t)link_map->l_addr, 0);
+  }
+#endif
   Pointer_sp handle_ptr = Pointer_O::create(handle);
   scope.pushSpecialVariableAndSet(_sym_STARcurrent_dlopen_handleSTAR, handle_ptr);
   if (startup_functions_are_waiting()) {
@@ -1382,15 +1431,16 @@ T_O* ltvc_read_object(gctools::GCRootsInModule* roots, T_sp stream, bool log, si
 }
 
 Cons_O* ltvc_read_list(gctools::GCRootsInModule* roots, size_t num, T_sp stream, bool log, size_t& index) {
-  ql::list result;
-  for ( size_t ii =0; ii<num; ++ii ) {
-    T_sp obj((gctools::Tagged)ltvc_read_object(roots,stream,log,index));
-    result << obj;
+  T_sp result = _Nil<T_O>();
+  if (num) {
+    result = gctools::ConsAllocator<Cons_O>::allocate_list(num,
+                                                           [&] (size_t) { return T_sp((gctools::Tagged)ltvc_read_object(roots,stream,log,index)); },
+                                                           _Nil<T_O>());
   }
   if (log) {
-    printf("%s:%d:%s list -> %s\n", __FILE__, __LINE__, __FUNCTION__, _rep_(result.cons()).c_str());
+    printf("%s:%d:%s list -> %s\n", __FILE__, __LINE__, __FUNCTION__, _rep_(result).c_str());
   }
-  return (Cons_O*)result.cons().tagged_();
+  return (Cons_O*)result.tagged_();
 }
 
 void ltvc_make_list_varargs( gctools::GCRootsInModule* roots, char tag, size_t index, size_t len, Cons_O* list)
@@ -140,13 +140,12 @@ CL_DEFUN List_sp cl__make_list(Fixnum_sp osize, T_sp initial_element) {
   // osize must be 0 or positive
   if (size < 0)
     TYPE_ERROR(osize, cl::_sym_UnsignedByte);
-  else {
-    ql::list result;
-    for (size_t i = 0; i < size; i++) {
-      result << initial_element;
-    }
-    return (result.cons());
+  else if (size == 0) {
+    return _Nil<T_O>();
   }
+  return gctools::ConsAllocator<Cons_O>::allocate_list(size,
+                                                       [initial_element] (size_t) { return initial_element; },
+                                                       _Nil<T_O>());
 };
 
 Cons_sp Cons_O::createList(T_sp o1) {
@@ -607,21 +606,21 @@ T_sp Cons_O::last(cl_index n) const {
 }
 
 List_sp Cons_O::copyList() const {
-  List_sp first, cur;
   List_sp p = this->asSmartPtr();
-  T_sp cdr;
-  first = Cons_O::create(oCar(p), _Nil<T_O>());
-  cur = first;
-  cdr = oCdr(p);
+  size_t len = 1;
+  T_sp cdr = oCdr(p);
   while (cdr.consp()) {
-    p = cdr;
-    List_sp newCar = Cons_O::create(oCar(p), _Nil<T_O>());
-    cur.asCons()->setCdr(newCar);
-    cur = newCar;
-    cdr = oCdr(p);
-  }
-  cur.asCons()->setCdr(cdr);
-  return first;
+    ++len;
+    cdr = CONS_CDR(cdr);
+  }
+  // cdr is now the terminating atom, usually NIL
+  T_sp cur = p;
+  return gctools::ConsAllocator<Cons_O>::allocate_list(len,
+                                                       [&cur] (size_t) {
+                                                         T_sp car = CONS_CAR(cur);
+                                                         cur = CONS_CDR(cur);
+                                                         return car; },
+                                                       cdr);
 };
 
 List_sp Cons_O::copyTree() const {
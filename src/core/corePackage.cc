@@ -417,6 +417,7 @@ SYMBOL_EXPORT_SC_(CorePkg, STARtopLevelCommandHookSTAR);
 SYMBOL_EXPORT_SC_(CorePkg, STARloadSearchListSTAR);
 SYMBOL_EXPORT_SC_(LlvmoPkg, load_bitcode);
 SYMBOL_EXPORT_SC_(LlvmoPkg, load_bitcode_ll);
+SYMBOL_EXPORT_SC_(LlvmoPkg, load_object_fasl);
 SYMBOL_EXPORT_SC_(CorePkg, loadSource);
 SYMBOL_EXPORT_SC_(CorePkg, load_binary);
 SYMBOL_EXPORT_SC_(ClPkg, STARloadPathnameSTAR);
@@ -58,6 +58,7 @@ THE SOFTWARE.
 #include <clasp/core/sort.h>
 #include <clasp/core/lispStream.h>
 #include <clasp/llvmo/llvmoExpose.h>
+#include <clasp/llvmo/sourcePositionTable.h>
 #include <clasp/core/wrappers.h>
 #ifdef _TARGET_OS_DARWIN
 #import <mach-o/dyld.h>
@@ -1814,6 +1815,13 @@ CL_DEFUN T_mv core__call_with_backtrace(Function_sp closure, bool args_as_pointe
         arguments = args_closure;
         closure = args_closure.second();
       }
+      // The return address is just past the call, look up the call itself
+      T_sp sourcePosition = _Nil<T_O>();
+      const char* file;
+      uint32_t line, column;
+      if (backtrace[i]._ReturnAddress!=0 && llvmo::lookup_source_position(backtrace[i]._ReturnAddress-1,file,line,column)) {
+        sourcePosition = Cons_O::createList(SimpleBaseString_O::make(file),core::make_fixnum(line),core::make_fixnum(column));
+      }
       args << INTERN_(kw,type) << stype
            << INTERN_(kw,return_address) << Pointer_O::create((void*)backtrace[i]._ReturnAddress)
            << INTERN_(kw,raw_name) <<  SimpleBaseString_O::make(backtrace[i]._SymbolName)
@@ -1824,7 +1832,8 @@ CL_DEFUN T_mv core__call_with_backtrace(Function_sp closure, bool args_as_pointe
            << INTERN_(kw,function_end_address) << Pointer_O::create((void*)backtrace[i]._FunctionEnd)
            << INTERN_(kw,function_description) << funcDesc
            << INTERN_(kw,arguments) << arguments
-           << INTERN_(kw,closure) << closure;
+           << INTERN_(kw,closure) << closure
+           << INTERN_(kw,source_position) << sourcePosition;
       if (_sym_make_backtrace_frame->fboundp()) {
         entry = core__apply0(_sym_make_backtrace_frame->symbolFunction(),args.cons());
       } else {
@@ -1994,6 +2003,17 @@ CL_DEFUN core::T_mv core__lookup_address(core::Pointer_sp address) {
   char type;
   bool foundSymbol = lookup_address((uintptr_t)address->ptr(),symbol,start,end,type);
   if (foundSymbol) {
+    const char* file;
+    uint32_t line, column;
+    if (llvmo::lookup_source_position((uintptr_t)address->ptr(),file,line,column)) {
+      return Values(core::SimpleBaseString_O::make(symbol),
+                    core::Pointer_O::create((void*)start),
+                    core::Pointer_O::create((void*)end),
+                    core::clasp_make_character(type),
+                    core::SimpleBaseString_O::make(file),
+                    core::clasp_make_integer(line),
+                    core::clasp_make_integer(column));
+    }
     return Values(core::SimpleBaseString_O::make(symbol),
                   core::Pointer_O::create((void*)start),
                   core::Pointer_O::create((void*)end),
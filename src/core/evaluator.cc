@@ -139,6 +139,45 @@ extern "C" void cc_protect_alloca(char* ptr);
 #define GET_AND_ADVANCE_VASLIST(x_,cur_) {x_ = cur_->next_arg_raw(); };
 #define REG_ARGS 4  // 4 common lisp arguments in registers
 
+/*! Call func with every argument remaining in args.
+    Used by funcall_consume_valist_ when there are more arguments than the
+    generated applyToFrame.h cases handle.  The arguments beyond REG_ARGS are
+    copied into the variadic array at the bottom of this stack frame (see the TRICK above)
+    so there is no fixed limit on the number of arguments and nothing is consed. */
+NOINLINE gctools::return_type funcall_consume_valist_spread(T_O* func_tagged, VaList_sp args) {
+  Function_sp func((gc::Tagged)func_tagged);
+  T_O* a0;
+  T_O* a1;
+  T_O* a2;
+  T_O* a3;
+  size_t nargs = args->remaining_nargs();
+  ASSERT(nargs>REG_ARGS);
+  GET_AND_ADVANCE_VASLIST(a0,args);
+  GET_AND_ADVANCE_VASLIST(a1,args);
+  GET_AND_ADVANCE_VASLIST(a2,args);
+  GET_AND_ADVANCE_VASLIST(a3,args);
+  ALLOCA_variadic();
+  for ( size_t idx = 0; idx<(nargs-REG_ARGS); ++idx ) {
+    GET_AND_ADVANCE_VASLIST(variadic[idx],args);
+  }
+  return (*func).entry.load()(func.raw_(),nargs,a0,a1,a2,a3);
+}
+
+/*! Like funcall_consume_valist_spread but the arguments are in a Frame */
+NOINLINE gctools::return_type funcall_frame_spread(Function_sp func, gctools::Frame* frame) {
+  size_t nargs = (*frame).number_of_arguments();
+  ASSERT(nargs>REG_ARGS);
+  ALLOCA_variadic();
+  for ( size_t idx = 0; idx<(nargs-REG_ARGS); ++idx ) {
+    variadic[idx] = ENSURE_VALID_OBJECT((*frame)[idx+REG_ARGS]);
+  }
+  return (*func).entry.load()(func.raw_(),nargs,
+                              ENSURE_VALID_OBJECT((*frame)[0]),
+                              ENSURE_VALID_OBJECT((*frame)[1]),
+                              ENSURE_VALID_OBJECT((*frame)[2]),
+                              ENSURE_VALID_OBJECT((*frame)[3]));
+}
+
 CL_LAMBDA(head core:&va-rest args);
 CL_DECLARE();
 CL_DOCSTRING("apply");
@@ -2756,7 +2795,8 @@ gctools::return_type funcall_frame(Function_sp func, gctools::Frame* frame)
 #include <clasp/core/applyToFrame.h>
 #undef APPLY_TO_FRAME
   default:
-      SIMPLE_ERROR(BF("Function call with %lu arguments exceeded the call-arguments-limit %lu") % (*frame).number_of_arguments() % CALL_ARGUMENTS_LIMIT);
+      // More arguments than applyToFrame.h has cases for - spread them on the stack
+      return funcall_frame_spread(func,frame);
   };
 }
 
@@ -209,12 +209,9 @@ CL_DEFUN String_sp core__get_thread_local_write_to_string_output_stream_string(S
 {
   // This is like get-string-output-stream-string but it checks the size of the
   // buffer string and if it is too large it knocks it down to 128 characters
-  String_sp buffer = StringOutputStreamOutputString(my_stream);
-  String_sp result = gc::As_unsafe<String_sp>(cl__copy_seq(buffer));
-  if (buffer->length()>1024) {
+  String_sp result = gc::As_unsafe<String_sp>(cl__get_output_stream_string(my_stream));
+  if (StringOutputStreamOutputString(my_stream)->arrayTotalSize()>1024) {
     StringOutputStreamOutputString(my_stream) = Str8Ns_O::createBufferString(128);
-  } else {
-    SetStringFillp(buffer,core::make_fixnum(0));
   }
   return result;
 }
@@ -784,6 +781,25 @@ generic_read_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
   return start;
 }
 
+/*! Copy n elements from src starting at sstart into dest starting at dstart.
+    If both vectors have the same specialized element type, the storage is
+    copied directly. Otherwise each element is moved with rowMajorAref/Aset. */
+static void
+copy_vector_range(Vector_sp dest, cl_index dstart, Vector_sp src, cl_index sstart, cl_index n) {
+  if (n == 0)
+    return;
+  clasp_elttype dt = dest->elttype();
+  if (dt == src->elttype() && dt != clasp_aet_object && dt != clasp_aet_bit && dt != clasp_aet_non_standard) {
+    memmove(dest->rowMajorAddressOfElement_(dstart),
+            src->rowMajorAddressOfElement_(sstart),
+            n * dest->elementSizeInBytes());
+    return;
+  }
+  for (cl_index i = 0; i < n; ++i) {
+    dest->rowMajorAset(dstart + i, src->rowMajorAref(sstart + i));
+  }
+}
+
 /**********************************************************************
  * CHARACTER AND EXTERNAL FORMAT SUPPORT
  */
@@ -1561,11 +1577,133 @@ const FileOps clos_stream_ops = {
 
 /**********************************************************************
  * STRING OUTPUT STREAMS
+ *
+ * A stream that owns its buffer (MAKE-STRING-OUTPUT-STREAM and
+ * WITH-OUTPUT-TO-STRING without a string) never regrows it.  When the
+ * current chunk fills up it is pushed onto _Chunks and writing carries on
+ * in a new chunk, twice the size up to STRING_OUTPUT_MAX_CHUNK.  Every
+ * character is then copied once more, into the string that
+ * GET-OUTPUT-STREAM-STRING allocates at its final size, or not at all by
+ * CORE:WRITE-OUTPUT-STREAM-STRING.  An element-type CHARACTER stream
+ * writes base-char chunks until it sees a character that needs more.
+ * Streams onto a user supplied string write into that string.
  */
 
+#define STRING_OUTPUT_INITIAL_CHUNK 128
+#define STRING_OUTPUT_MAX_CHUNK 16384
+
+/*! Copy N characters between strings, widening or narrowing between base-char
+    and character storage.  Narrowing is only for characters known to fit. */
+static void
+copy_string_range(String_sp dest, cl_index dstart, String_sp src, cl_index sstart, cl_index n) {
+  if (n == 0)
+    return;
+  clasp_elttype dt = dest->elttype();
+  clasp_elttype st = src->elttype();
+  if (dt == clasp_aet_ch && st == clasp_aet_bc) {
+    claspCharacter *dp = static_cast<claspCharacter *>(dest->rowMajorAddressOfElement_(dstart));
+    const claspChar *sp = static_cast<const claspChar *>(src->rowMajorAddressOfElement_(sstart));
+    for (cl_index i = 0; i < n; ++i)
+      dp[i] = sp[i];
+    return;
+  }
+  if (dt == clasp_aet_bc && st == clasp_aet_ch) {
+    claspChar *dp = static_cast<claspChar *>(dest->rowMajorAddressOfElement_(dstart));
+    const claspCharacter *sp = static_cast<const claspCharacter *>(src->rowMajorAddressOfElement_(sstart));
+    for (cl_index i = 0; i < n; ++i)
+      dp[i] = static_cast<claspChar>(sp[i]);
+    return;
+  }
+  copy_vector_range(dest, dstart, src, sstart, n);
+}
+
+/*! The largest character code among N characters of a character string */
+static claspCharacter
+string_range_max_char(String_sp src, cl_index start, cl_index n) {
+  const claspCharacter *sp = static_cast<const claspCharacter *>(src->rowMajorAddressOfElement_(start));
+  claspCharacter m = 0;
+  for (cl_index i = 0; i < n; ++i)
+    m = std::max(m, sp[i]);
+  return m;
+}
+
+static String_sp
+str_out_make_chunk(cl_index size, bool wide) {
+  if (wide)
+    return StrWNs_O::createBufferString(size);
+  return Str8Ns_O::createBufferString(size);
+}
+
+static void
+str_out_retire_chunk(StringOutputStream_sp sout) {
+  String_sp chunk = sout->_Contents;
+  cl_index size = chunk->arrayTotalSize();
+  sout->_Chunks = Cons_O::create(chunk, sout->_Chunks);
+  sout->_ChunksLength += chunk->fillPointer();
+  sout->_Contents = str_out_make_chunk(std::min<cl_index>(2 * size, STRING_OUTPUT_MAX_CHUNK),
+                                       chunk->elttype() == clasp_aet_ch);
+}
+
+/*! Switch the current chunk to character storage */
+static void
+str_out_widen_chunk(StringOutputStream_sp sout) {
+  String_sp chunk = sout->_Contents;
+  cl_index fill = chunk->fillPointer();
+  String_sp wide = str_out_make_chunk(chunk->arrayTotalSize(), true);
+  wide->fillPointerSet(fill);
+  copy_string_range(wide, 0, chunk, 0, fill);
+  sout->_Contents = wide;
+}
+
+/*! Everything written to a chunked stream, as one simple string */
+static String_sp
+str_out_collect(StringOutputStream_sp sout) {
+  String_sp chunk = sout->_Contents;
+  cl_index fill = chunk->fillPointer();
+  cl_index total = sout->_ChunksLength + fill;
+  String_sp result;
+  if (sout->_Extended)
+    result = SimpleCharacterString_O::make(total);
+  else
+    result = SimpleBaseString_O::make(total);
+  copy_string_range(result, sout->_ChunksLength, chunk, 0, fill);
+  // The chunks are newest first, so fill the result from the back
+  cl_index pos = sout->_ChunksLength;
+  for (auto cur : sout->_Chunks) {
+    String_sp old = gc::As_unsafe<String_sp>(oCar(cur));
+    cl_index len = old->fillPointer();
+    pos -= len;
+    copy_string_range(result, pos, old, 0, len);
+  }
+  return result;
+}
+
+static void
+str_out_clear(StringOutputStream_sp sout) {
+  sout->_Chunks = _Nil<T_O>();
+  sout->_ChunksLength = 0;
+  sout->_Contents->fillPointerSet(0);
+}
+
+/*! Fold the chunks back into a single buffer, for FILE-POSITION */
+static void
+str_out_flatten(StringOutputStream_sp sout) {
+  if (sout->_Chunks.nilp())
+    return;
+  String_sp all = str_out_collect(sout);
+  cl_index len = all->length();
+  String_sp buffer = str_out_make_chunk(std::max<cl_index>(len, STRING_OUTPUT_INITIAL_CHUNK),
+                                        all->elttype() == clasp_aet_ch);
+  buffer->fillPointerSet(len);
+  copy_string_range(buffer, 0, all, 0, len);
+  sout->_Chunks = _Nil<T_O>();
+  sout->_ChunksLength = 0;
+  sout->_Contents = buffer;
+}
+
 static claspCharacter
 str_out_write_char(T_sp strm, claspCharacter c) {
-  //  StringOutputStream_sp sout = gc::As<StringOutputStream_sp>(strm);
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
   int column = StreamOutputColumn(strm);
   if (c == '\n')
     StreamOutputColumn(strm) = 0;
@@ -1573,24 +1711,94 @@ str_out_write_char(T_sp strm, claspCharacter c) {
     StreamOutputColumn(strm) = (column & ~(cl_index)7) + 8;
   else
     StreamOutputColumn(strm)++;
-  StringOutputStreamOutputString(strm)->vectorPushExtend(clasp_make_character(c));
+  if (sout->_Chunked) {
+    if (sout->_Contents->fillPointer() == sout->_Contents->arrayTotalSize())
+      str_out_retire_chunk(sout);
+    if (c > 255 && sout->_Extended && sout->_Contents->elttype() == clasp_aet_bc)
+      str_out_widen_chunk(sout);
+  }
+  sout->_Contents->vectorPushExtend(clasp_make_character(c));
   return c;
 }
 
+static cl_index
+str_out_write_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
+  if (start >= end)
+    return start;
+  unlikely_if (!cl__stringp(data))
+    return generic_write_vector(strm, data, start, end);
+  String_sp src = gc::As_unsafe<String_sp>(data);
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
+  if (sout->_Chunked) {
+    for (cl_index pos = start; pos < end;) {
+      String_sp chunk = sout->_Contents;
+      cl_index fill = chunk->fillPointer();
+      cl_index space = chunk->arrayTotalSize() - fill;
+      if (space == 0) {
+        str_out_retire_chunk(sout);
+        continue;
+      }
+      cl_index n = std::min(space, end - pos);
+      if (chunk->elttype() == clasp_aet_bc && src->elttype() == clasp_aet_ch &&
+          string_range_max_char(src, pos, n) > 255) {
+        if (sout->_Extended) {
+          str_out_widen_chunk(sout);
+          continue;
+        }
+        // Not a base-char: let rowMajorAset signal the error
+        chunk->fillPointerSet(fill + n);
+        copy_vector_range(chunk, fill, src, pos, n);
+      } else {
+        chunk->fillPointerSet(fill + n);
+        copy_string_range(chunk, fill, src, pos, n);
+      }
+      pos += n;
+    }
+  } else {
+    MDArray_sp out = gc::As<MDArray_sp>(sout->_Contents);
+    cl_index n = end - start;
+    cl_index fill = out->fillPointer();
+    cl_index total = out->arrayTotalSize();
+    if (total - fill < n) {
+      // Grow at least geometrically like vectorPushExtend does
+      out->ensureSpaceAfterFillPointer(clasp_make_character(' '), std::max(n, total));
+    }
+    out->fillPointerSet(fill + n);
+    copy_vector_range(out, fill, src, start, n);
+  }
+  cl_index column = StreamOutputColumn(strm);
+  for (cl_index i = start; i < end; ++i) {
+    claspCharacter c = clasp_as_claspCharacter(gc::As_unsafe<Character_sp>(src->rowMajorAref(i)));
+    if (c == '\n')
+      column = 0;
+    else if (c == '\t')
+      column = (column & ~(cl_index)7) + 8;
+    else
+      column++;
+  }
+  StreamOutputColumn(strm) = column;
+  return end;
+}
+
 static T_sp
 str_out_element_type(T_sp strm) {
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
+  if (sout->_Chunked)
+    return sout->_Extended ? cl::_sym_character : cl::_sym_base_char;
   T_sp tstring = StringOutputStreamOutputString(strm);
   ASSERT(cl__stringp(tstring));
   return gc::As_unsafe<String_sp>(tstring)->arrayElementType();
 }
 
 T_sp str_out_get_position(T_sp strm) {
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
   String_sp str = StringOutputStreamOutputString(strm);
-  return Integer_O::create((gc::Fixnum)(StringFillp(str)));
+  return Integer_O::create((gc::Fixnum)(sout->_ChunksLength + StringFillp(str)));
 }
 
 static T_sp
 str_out_set_position(T_sp strm, T_sp pos) {
+  str_out_flatten(gc::As_unsafe<StringOutputStream_sp>(strm));
   String_sp string = StringOutputStreamOutputString(strm);
   Fixnum disp;
   if (pos.nilp()) {
@@ -1626,7 +1834,7 @@ const FileOps str_out_ops = {
     generic_peek_char,
 
     generic_read_vector,
-    generic_write_vector,
+    str_out_write_vector,
 
     not_input_listen,
     not_input_clear_input,
@@ -1678,17 +1886,13 @@ CL_DEFUN T_sp core__make_string_output_stream_from_string(T_sp s) {
 }
 
 T_sp clasp_make_string_output_stream(cl_index line_length, bool extended) {
+  T_sp strm = core__make_string_output_stream_from_string(Str8Ns_O::createBufferString(line_length));
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
+  sout->_Chunked = true;
 #ifdef CLASP_UNICODE
-  T_sp s;
-  if (extended) {
-    s = StrWNs_O::createBufferString(line_length);
-  } else {
-    s = Str8Ns_O::createBufferString(line_length);
-  }
-#else
-  T_sp s = Str8Ns_O::createBufferString(line_length); // clasp_alloc_adjustable_base_string(line_length);
+  sout->_Extended = extended;
 #endif
-  return core__make_string_output_stream_from_string(s);
+  return strm;
 }
 
 CL_LAMBDA("&key (element-type 'character)");
@@ -1722,6 +1926,12 @@ CL_DEFUN T_sp cl__get_output_stream_string(T_sp strm) {
   T_sp strng;
   unlikely_if(!AnsiStreamTypeP(strm, clasp_smm_string_output))
       af_wrongTypeOnlyArg(__FILE__, __LINE__, cl::_sym_getOutputStreamString, strm, cl::_sym_StringStream_O);
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
+  if (sout->_Chunked) {
+    strng = str_out_collect(sout);
+    str_out_clear(sout);
+    return strng;
+  }
   String_sp buffer = StringOutputStreamOutputString(strm);
   //        printf("%s:%d StringOutputStreamOutputString = %s\n", __FILE__, __LINE__, buffer->get().c_str());
   strng = cl__copy_seq(buffer);
@@ -1729,6 +1939,31 @@ CL_DEFUN T_sp cl__get_output_stream_string(T_sp strm) {
   return strng;
 }
 
+SYMBOL_EXPORT_SC_(CorePkg, write_output_stream_string);
+CL_LAMBDA(string-output-stream stream);
+CL_DECLARE();
+CL_DOCSTRING("Write the characters accumulated in STRING-OUTPUT-STREAM to STREAM and clear it, like (write-string (get-output-stream-string string-output-stream) stream) but a chunk at a time, without building the string.");
+CL_DEFUN T_sp core__write_output_stream_string(T_sp strm, T_sp stream) {
+  unlikely_if(!AnsiStreamTypeP(strm, clasp_smm_string_output))
+      af_wrongTypeOnlyArg(__FILE__, __LINE__, _sym_write_output_stream_string, strm, cl::_sym_StringStream_O);
+  StringOutputStream_sp sout = gc::As_unsafe<StringOutputStream_sp>(strm);
+  if (!sout->_Chunked) {
+    String_sp buffer = StringOutputStreamOutputString(strm);
+    cl__write_sequence(buffer, stream, make_fixnum(0), _Nil<T_O>());
+    SetStringFillp(buffer,0);
+    return stream;
+  }
+  // The chunks are kept newest first
+  List_sp oldest_first = _Nil<T_O>();
+  for (auto cur : sout->_Chunks)
+    oldest_first = Cons_O::create(oCar(cur), oldest_first);
+  for (auto cur : oldest_first)
+    cl__write_sequence(oCar(cur), stream, make_fixnum(0), _Nil<T_O>());
+  cl__write_sequence(sout->_Contents, stream, make_fixnum(0), _Nil<T_O>());
+  str_out_clear(sout);
+  return stream;
+}
+
 /**********************************************************************
  * STRING INPUT STREAMS
  */
@@ -1746,6 +1981,21 @@ str_in_read_char(T_sp strm) {
   return c;
 }
 
+static cl_index
+str_in_read_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
+  if (start >= end)
+    return start;
+  gctools::Fixnum curr_pos = StringInputStreamInputPosition(strm);
+  gctools::Fixnum avail = StringInputStreamInputLimit(strm) - curr_pos;
+  if (avail <= 0)
+    return start;
+  cl_index n = std::min((cl_index)avail, end - start);
+  copy_vector_range(gc::As<Vector_sp>(data), start,
+                    StringInputStreamInputString(strm), curr_pos, n);
+  StringInputStreamInputPosition(strm) = curr_pos + n;
+  return start + n;
+}
+
 static void
 str_in_unread_char(T_sp strm, claspCharacter c) {
   gctools::Fixnum curr_pos = StringInputStreamInputPosition(strm);
@@ -1812,7 +2062,7 @@ const FileOps str_in_ops = {
     str_in_unread_char,
     str_in_peek_char,
 
-    generic_read_vector,
+    str_in_read_vector,
     generic_write_vector,
 
     str_in_listen,
@@ -2998,13 +3248,99 @@ io_file_close(T_sp strm) {
   return generic_close(strm);
 }
 
+/*! True if the elements of vec are exactly the bytes of the binary stream strm */
+static bool
+octet_stream_vector_p(T_sp strm, Vector_sp vec) {
+  if ((StreamFlags(strm) & CLASP_STREAM_FORMAT) != CLASP_STREAM_BINARY ||
+      StreamByteSize(strm) != 8)
+    return false;
+  if (StreamFlags(strm) & CLASP_STREAM_SIGNED_BYTES)
+    return vec->elttype() == clasp_aet_int8_t;
+  return vec->elttype() == clasp_aet_byte8_t;
+}
+
+/*! True if strm decodes each byte to the base-char with that code and
+    vec is a base-string, so the bytes can go straight into its storage */
+static bool
+latin_1_stream_base_string_p(T_sp strm, Vector_sp vec, bool input) {
+#ifdef CLASP_UNICODE
+  if (vec->elttype() != clasp_aet_bc)
+    return false;
+  if (input)
+    return StreamOps(strm).read_char == eformat_read_char &&
+           StreamDecoder(strm) == passthrough_decoder &&
+           StreamEofChar(strm) == EOF;
+  return StreamOps(strm).write_char == eformat_write_char &&
+         StreamEncoder(strm) == passthrough_encoder;
+#else
+  return false;
+#endif
+}
+
 static cl_index
 io_file_read_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
+  if (start >= end)
+    return start;
+  Vector_sp vec = gc::As<Vector_sp>(data);
+  bool octets = octet_stream_vector_p(strm, vec);
+  if (octets || latin_1_stream_base_string_p(strm, vec, true)) {
+    cl_index (*read_byte8)(T_sp, unsigned char *, cl_index) = StreamOps(strm).read_byte8;
+    unsigned char *buffer = (unsigned char *)vec->rowMajorAddressOfElement_(start);
+    cl_index first = start;
+    while (start < end) {
+      // read() returns short counts for pipes and sockets, keep going until EOF
+      gctools::Fixnum nread = (gctools::Fixnum)read_byte8(strm, buffer + (start - first), end - start);
+      if (nread <= 0)
+        break;
+      start += nread;
+    }
+    if (!octets && start > first) {
+      // Keep the state that eformat_read_char would have left behind
+      for (cl_index i = first; i < start; ++i) {
+        claspCharacter c = buffer[i - first];
+        StreamInputCursor(strm).advanceForChar(strm, c, c);
+      }
+      claspCharacter last = buffer[start - first - 1];
+      StreamLastChar(strm) = last;
+      StreamLastCode(strm, 0) = last;
+      StreamLastCode(strm, 1) = EOF;
+    }
+    return start;
+  }
   return generic_read_vector(strm, data, start, end);
 }
 
 static cl_index
 io_file_write_vector(T_sp strm, T_sp data, cl_index start, cl_index end) {
+  if (start >= end)
+    return start;
+  Vector_sp vec = gc::As<Vector_sp>(data);
+  bool octets = octet_stream_vector_p(strm, vec);
+  if (octets || latin_1_stream_base_string_p(strm, vec, false)) {
+    cl_index (*write_byte8)(T_sp, unsigned char *, cl_index) = StreamOps(strm).write_byte8;
+    unsigned char *buffer = (unsigned char *)vec->rowMajorAddressOfElement_(start);
+    cl_index first = start;
+    while (start < end) {
+      gctools::Fixnum nwritten = (gctools::Fixnum)write_byte8(strm, buffer + (start - first), end - start);
+      if (nwritten <= 0)
+        break;
+      start += nwritten;
+    }
+    if (!octets) {
+      cl_index column = StreamOutputColumn(strm);
+      for (cl_index i = first; i < start; ++i) {
+        unsigned char c = buffer[i - first];
+        if (c == '\n')
+          column = 0;
+        else if (c == '\t')
+          column = (column & ~((cl_index)07)) + 8;
+        else
+          column++;
+      }
+      StreamOutputColumn(strm) = column;
+    }
+    return start;
+  }
   return generic_write_vector(strm, data, start, end);
 }
 
@@ -5543,13 +5879,14 @@ namespace core {
 
 
 void StringOutputStream_O::fill(const string &data) {
-  StringPushStringCharStar(this->_Contents,data.c_str());
+  clasp_write_string(data, this->asSmartPtr());
 }
 
 /*! Get the contents and reset them */
 String_sp StringOutputStream_O::getAndReset() {
-  String_sp contents = this->_Contents;
-  StringOutputStreamOutputString(this->asSmartPtr()) = Str8Ns_O::createBufferString(128);
+  String_sp contents = gc::As_unsafe<String_sp>(cl__get_output_stream_string(this->asSmartPtr()));
+  if (this->_Contents->arrayTotalSize() > 1024)
+    StringOutputStreamOutputString(this->asSmartPtr()) = Str8Ns_O::createBufferString(128);
   StreamOutputColumn(this->asSmartPtr()) = 0;
   return contents;
 };
@@ -191,6 +191,8 @@ void start_thread_inner(Process_sp process, void* cold_end_of_stack) {
   }
   result_list = core::Cons_O::create(result0,result_list);
   process->_ReturnValuesList = result_list;
+  // thread_local_state_low_level is about to go out of scope
+  gctools::release_safepoint_word(my_thread);
   
 //  gctools::unregister_thread(process);
 //  printf("%s:%d leaving start_thread\n", __FILE__, __LINE__);
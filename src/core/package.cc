@@ -498,7 +498,7 @@ Symbol_mv Package_O::findSymbol_SimpleString_no_lock(SimpleString_sp nameKey) co
       LOG(BF("Looking in package[%s]") % _rep_(upkg));
       T_mv eu = upkg->_ExternalSymbols->gethash(nameKey, _Nil<T_O>());
       val = gc::As<Symbol_sp>(eu);
-      foundp = ei.second().isTrue();
+      foundp = eu.second().isTrue();
       if (foundp) {
         LOG(BF("Found it in the _ExternalsSymbols list - returning[%s]") % (_rep_(val)));
         return Values(val, kw::_sym_inherited);
@@ -1368,27 +1368,36 @@ CL_LAMBDA(core:&va-rest lists);
 CL_DECLARE();
 CL_DOCSTRING("append as in clhs");
 CL_DEFUN T_sp cl__append(VaList_sp args) {
-  ql::list list;
   LOG(BF("Carrying out append with arguments: %s") % _rep_(lists));
   size_t lenArgs = args->total_nargs();
   unlikely_if (lenArgs==0) return _Nil<T_O>();
-  T_O* lastArg = args->relative_indexed_arg(lenArgs-1);
-  for ( int i(0),iEnd(lenArgs-1);i<iEnd; ++i ) {
-    T_sp curit = args->next_arg();
+  T_sp last((gctools::Tagged)args->relative_indexed_arg(lenArgs-1));
+  // Count the conses to copy first so the new list is allocated in one batch
+  size_t total = 0;
+  for ( size_t i(0),iEnd(lenArgs-1);i<iEnd; ++i ) {
+    T_sp curit((gctools::Tagged)args->relative_indexed_arg(i));
     LIKELY_if (curit.consp()) {
       for (auto inner : (List_sp)curit) {
-        list << CONS_CAR(inner);
+        (void)inner;
+        ++total;
       }
     } else if (!curit.nilp()) {
       TYPE_ERROR(curit,cl::_sym_list);
     }
   }
-  /* Now append the last argument by setting the new lists last element cdr
-       to the last argument of append */
-  T_sp last((gctools::Tagged)lastArg);
-  list.dot(last);
-  T_sp res = list.cons();
-  return res;
+  if (total == 0) return last;
+  /* The cdr of the new list's last cons is the last argument of append */
+  size_t argIndex = 0;
+  T_sp cur((gctools::Tagged)args->relative_indexed_arg(0));
+  return gctools::ConsAllocator<Cons_O>::allocate_list(total,
+                                                       [&] (size_t) {
+                                                         while (!cur.consp()) {
+                                                           cur = T_sp((gctools::Tagged)args->relative_indexed_arg(++argIndex));
+                                                         }
+                                                         T_sp car = CONS_CAR(cur);
+                                                         cur = CONS_CDR(cur);
+                                                         return car; },
+                                                       last);
 }
 
 CL_LAMBDA(sequence start end);
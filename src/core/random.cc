@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <clasp/core/symbol.h>
 #include <clasp/core/hashTable.h>
 #include <clasp/core/random.h>
+#include <clasp/core/array.h>
 #include <clasp/core/wrappers.h>
 
 namespace core {
@@ -59,23 +60,86 @@ CL_DEFUN RandomState_sp RandomState_O::make(T_sp state) {
                                          Cons_O::createList(cl::_sym_Integer_O, make_fixnum(1)),                   \
                                          Cons_O::createList(cl::_sym_float, Cons_O::createList(clasp_make_single_float(0.0)))))
 
-CL_LAMBDA(olimit &optional (random-state cl:*random-state*));
-CL_DECLARE();
-CL_DOCSTRING("random");
-CL_DEFUN T_sp cl__random(Number_sp olimit, RandomState_sp random_state) {
+/*! Draw integers in [0,limit).  The distribution is built once so that bulk
+    fills don't pay for it on every element. */
+template <typename Gen>
+struct BoundedDraw {
+  boost::random::uniform_int_distribution<uint64_t> _Range;
+  BoundedDraw(uint64_t limit) : _Range(0, limit - 1) {};
+  inline uint64_t operator()(Gen& gen) { return this->_Range(gen); };
+};
+
+/*! Lemire's multiply-shift rejection method - one 64x64->128 multiply per draw
+    and a division only to set up the rejection threshold. */
+template <>
+struct BoundedDraw<Xoshiro256ss> {
+  uint64_t _Limit;
+  uint64_t _Threshold;
+  BoundedDraw(uint64_t limit) : _Limit(limit), _Threshold((0 - limit) % limit) {};
+  inline uint64_t operator()(Xoshiro256ss& gen) {
+    while (1) {
+      __uint128_t m = (__uint128_t)gen() * this->_Limit;
+      if ((uint64_t)m >= this->_Threshold) return (uint64_t)(m >> 64);
+    }
+  };
+};
+
+/*! Draw reals in [0,limit) */
+template <typename Gen>
+struct RealDraw {
+  boost::random::uniform_real_distribution<double> _Range;
+  RealDraw(double limit) : _Range(0.0, limit) {};
+  inline double operator()(Gen& gen) { return this->_Range(gen); };
+};
+
+/*! Use the top 53 bits of one draw as the mantissa */
+template <>
+struct RealDraw<Xoshiro256ss> {
+  double _Limit;
+  RealDraw(double limit) : _Limit(limit) {};
+  inline double operator()(Xoshiro256ss& gen) {
+    double r = (gen() >> 11) * 0x1.0p-53 * this->_Limit;
+    // Rounding can reach the limit when it is not a power of two
+    return r < this->_Limit ? r : std::nextafter(this->_Limit, 0.0);
+  };
+};
+
+/*! Jump ahead 2^128 draws - the jump polynomial is from the reference implementation */
+void Xoshiro256ss::jump() {
+  static const uint64_t JUMP[] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+  uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for ( size_t i=0; i<sizeof(JUMP)/sizeof(*JUMP); ++i ) {
+    for ( int b=0; b<64; ++b ) {
+      if (JUMP[i] & ((uint64_t)1 << b)) {
+        s0 ^= this->_State[0];
+        s1 ^= this->_State[1];
+        s2 ^= this->_State[2];
+        s3 ^= this->_State[3];
+      }
+      (*this)();
+    }
+  }
+  this->_State[0] = s0;
+  this->_State[1] = s1;
+  this->_State[2] = s2;
+  this->_State[3] = s3;
+}
+
+template <typename Gen>
+T_sp random_with_generator(Gen& gen, Number_sp olimit) {
   // olimit---a positive integer, or a positive float.
   // Fixing #292
   if (olimit.fixnump()) {
     gc::Fixnum n = olimit.unsafe_fixnum();
     if (n > 0) {
-      boost::random::uniform_int_distribution<uint64_t> range(0, n - 1);
-      return make_fixnum(range(random_state->_Producer));
+      BoundedDraw<Gen> range(n);
+      return make_fixnum(range(gen));
     } else TYPE_ERROR_cl_random(olimit);
   } else if (gc::IsA<Bignum_sp>(olimit)) {
     Bignum_sp gbn = gc::As_unsafe<Bignum_sp>(olimit);
     if (clasp_plusp (gbn)) {
-      boost::uniform_int<bmp::mpz_int> gen(0, bmp::mpz_int(gbn->get().get_mpz_t()));
-      auto rnd = gen(random_state->_Producer);
+      boost::uniform_int<bmp::mpz_int> range(0, bmp::mpz_int(gbn->get().get_mpz_t()));
+      auto rnd = range(gen);
       bmp::mpz_int v = rnd;
       mpz_t z;
       mpz_init(z);
@@ -85,21 +149,149 @@ CL_DEFUN T_sp cl__random(Number_sp olimit, RandomState_sp random_state) {
     else TYPE_ERROR_cl_random(olimit);
   } else if (DoubleFloat_sp df = olimit.asOrNull<DoubleFloat_O>()) {
     if (df->get() > 0.0) {
-      boost::random::uniform_real_distribution<> range(0.0, df->get());
-      return DoubleFloat_O::create(range(random_state->_Producer));
+      RealDraw<Gen> range(df->get());
+      return DoubleFloat_O::create(range(gen));
     } else TYPE_ERROR_cl_random(olimit);
   } else if (olimit.single_floatp()) {
     float flimit = olimit.unsafe_single_float();
     if (flimit >  0.0f) {
-      boost::random::uniform_real_distribution<> range(0.0, flimit);
-      return clasp_make_single_float(range(random_state->_Producer));
+      RealDraw<Gen> range(flimit);
+      float r = range(gen);
+      // Narrowing to single can round up to the limit
+      return clasp_make_single_float(r < flimit ? r : std::nextafter(flimit, 0.0f));
     } else TYPE_ERROR_cl_random(olimit);
   }
   TYPE_ERROR_cl_random(olimit);
 }
 
+CL_LAMBDA(olimit &optional (random-state cl:*random-state*));
+CL_DECLARE();
+CL_DOCSTRING("random");
+CL_DEFUN T_sp cl__random(Number_sp olimit, RandomState_sp random_state) {
+  if (random_state->_Kind == RandomState_O::xoshiro256_generator) {
+    return random_with_generator(random_state->_Xoshiro, olimit);
+  }
+  return random_with_generator(random_state->_Producer, olimit);
+}
+
+SYMBOL_EXPORT_SC_(KeywordPkg, mt19937);
+SYMBOL_EXPORT_SC_(KeywordPkg, xoshiro256);
+
+CL_LAMBDA(kind &optional seed);
+CL_DOCSTRING("Return a new random-state that uses the generator KIND, one of :mt19937 (the default for cl:make-random-state) or :xoshiro256. SEED is a non-negative integer or NIL to seed from the clock.");
+CL_DEFUN RandomState_sp core__make_random_state_with_generator(Symbol_sp kind, T_sp seed) {
+  RandomState_O::GeneratorKind gkind;
+  if (kind == kw::_sym_mt19937) gkind = RandomState_O::mt19937_generator;
+  else if (kind == kw::_sym_xoshiro256) gkind = RandomState_O::xoshiro256_generator;
+  else SIMPLE_ERROR(BF("Unknown random-state generator %s - only :mt19937 and :xoshiro256 are allowed") % _rep_(kind));
+  GC_ALLOCATE_VARIADIC(RandomState_O, rs, seed.nilp(), gkind);
+  if (seed.notnilp()) {
+    uint64_t useed = clasp_to_uint64_t(seed);
+    rs->_Producer.seed(static_cast<RandomState_O::Generator::result_type>(useed));
+    rs->_Xoshiro.seed(useed);
+  }
+  return rs;
+}
+
+CL_LAMBDA(random-state);
+CL_DOCSTRING("Return the generator kind of RANDOM-STATE, :mt19937 or :xoshiro256.");
+CL_DEFUN Symbol_sp core__random_state_generator(RandomState_sp random_state) {
+  return random_state->_Kind == RandomState_O::xoshiro256_generator ? kw::_sym_xoshiro256 : kw::_sym_mt19937;
+}
 
+CL_LAMBDA(random-state);
+CL_DOCSTRING("Return a copy of the :xoshiro256 RANDOM-STATE and jump RANDOM-STATE ahead by 2^128 draws. Successive calls hand out non-overlapping streams, e.g. one per thread, that are reproducible from a single seed.");
+CL_DEFUN RandomState_sp core__random_state_split(RandomState_sp random_state) {
+  if (random_state->_Kind != RandomState_O::xoshiro256_generator) {
+    SIMPLE_ERROR(BF("Only :xoshiro256 random-states can be split - %s is not") % _rep_(random_state));
+  }
+  RandomState_sp stream = RandomState_O::create(random_state);
+  random_state->_Xoshiro.jump();
+  return stream;
+}
 
+template <typename Gen, typename Vector>
+void random_fill_integers(Gen& gen, Vector& vec, size_t start, size_t end, T_sp limit) {
+  typedef typename Vector::value_type value_type;
+  uint64_t ulimit = clasp_to_uint64_t(limit);
+  if (ulimit == 0 || (ulimit - 1) > (uint64_t)std::numeric_limits<value_type>::max()) {
+    SIMPLE_ERROR(BF("The limit %s does not fit the element type %s") % _rep_(limit) % _rep_(vec.element_type()));
+  }
+  BoundedDraw<Gen> range(ulimit);
+  for ( size_t i=start; i<end; ++i ) vec[i] = static_cast<value_type>(range(gen));
+}
 
+template <typename Gen, typename Vector>
+void random_fill_reals(Gen& gen, Vector& vec, size_t start, size_t end, T_sp limit) {
+  typedef typename Vector::value_type value_type;
+  double dlimit = clasp_to_double(gc::As<Number_sp>(limit));
+  if (!(dlimit > 0.0)) TYPE_ERROR_cl_random(limit);
+  RealDraw<Gen> range(dlimit);
+  value_type vlimit = static_cast<value_type>(dlimit);
+  value_type below = std::nextafter(vlimit, static_cast<value_type>(0));
+  for ( size_t i=start; i<end; ++i ) {
+    value_type r = static_cast<value_type>(range(gen));
+    vec[i] = r < vlimit ? r : below;
+  }
+}
+
+template <typename Gen>
+void random_fill_range(Gen& gen, AbstractSimpleVector_sp sv, size_t start, size_t end, T_sp limit) {
+  if (SimpleVector_double_sp v = sv.asOrNull<SimpleVector_double_O>()) random_fill_reals(gen, *v, start, end, limit);
+  else if (SimpleVector_float_sp v = sv.asOrNull<SimpleVector_float_O>()) random_fill_reals(gen, *v, start, end, limit);
+  else if (SimpleVector_fixnum_sp v = sv.asOrNull<SimpleVector_fixnum_O>()) {
+    // A positive fixnum limit keeps every element a fixnum
+    if (!limit.fixnump()) TYPE_ERROR(limit, cl::_sym_fixnum);
+    random_fill_integers(gen, *v, start, end, limit);
+  }
+  else if (SimpleVector_byte64_t_sp v = sv.asOrNull<SimpleVector_byte64_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_int64_t_sp v = sv.asOrNull<SimpleVector_int64_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_byte32_t_sp v = sv.asOrNull<SimpleVector_byte32_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_int32_t_sp v = sv.asOrNull<SimpleVector_int32_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_byte16_t_sp v = sv.asOrNull<SimpleVector_byte16_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_int16_t_sp v = sv.asOrNull<SimpleVector_int16_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_byte8_t_sp v = sv.asOrNull<SimpleVector_byte8_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else if (SimpleVector_int8_t_sp v = sv.asOrNull<SimpleVector_int8_t_O>()) random_fill_integers(gen, *v, start, end, limit);
+  else SIMPLE_ERROR(BF("random-fill needs a vector specialized on a float or integer type - not %s") % _rep_(sv));
+}
+
+template <typename Gen>
+void random_fill_normal_range(Gen& gen, AbstractSimpleVector_sp sv, size_t start, size_t end, double mean, double stddev) {
+  boost::random::normal_distribution<double> normal(mean, stddev);
+  if (SimpleVector_double_sp v = sv.asOrNull<SimpleVector_double_O>()) {
+    for ( size_t i=start; i<end; ++i ) (*v)[i] = normal(gen);
+  } else if (SimpleVector_float_sp v = sv.asOrNull<SimpleVector_float_O>()) {
+    for ( size_t i=start; i<end; ++i ) (*v)[i] = normal(gen);
+  } else SIMPLE_ERROR(BF("random-fill-normal needs a vector specialized on single-float or double-float - not %s") % _rep_(sv));
+}
+
+CL_LAMBDA(vector limit &optional (random-state cl:*random-state*));
+CL_DOCSTRING("Fill VECTOR, which must be specialized on a float or integer type, with (random LIMIT random-state) for every element in one call without boxing the elements. Returns VECTOR.");
+CL_DEFUN Array_sp core__random_fill(Array_sp vector, Number_sp limit, RandomState_sp random_state) {
+  AbstractSimpleVector_sp sv;
+  size_t start, end;
+  vector->asAbstractSimpleVectorRange(sv, start, end);
+  if (random_state->_Kind == RandomState_O::xoshiro256_generator) {
+    random_fill_range(random_state->_Xoshiro, sv, start, end, limit);
+  } else {
+    random_fill_range(random_state->_Producer, sv, start, end, limit);
+  }
+  return vector;
+}
+
+CL_LAMBDA(vector &optional (mean 0.0d0) (stddev 1.0d0) (random-state cl:*random-state*));
+CL_DOCSTRING("Fill VECTOR, which must be specialized on single-float or double-float, with normally distributed variates of MEAN and STDDEV. Returns VECTOR.");
+CL_DEFUN Array_sp core__random_fill_normal(Array_sp vector, double mean, double stddev, RandomState_sp random_state) {
+  if (!(stddev > 0.0)) SIMPLE_ERROR(BF("The standard deviation %f must be positive") % stddev);
+  AbstractSimpleVector_sp sv;
+  size_t start, end;
+  vector->asAbstractSimpleVectorRange(sv, start, end);
+  if (random_state->_Kind == RandomState_O::xoshiro256_generator) {
+    random_fill_normal_range(random_state->_Xoshiro, sv, start, end, mean, stddev);
+  } else {
+    random_fill_normal_range(random_state->_Producer, sv, start, end, mean, stddev);
+  }
+  return vector;
+}
 
 };
@@ -0,0 +1,334 @@
+/*
+    File: sampleProfiler.cc
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+
+See directory 'clasp/licenses' for full details.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+
+//
+// A statistical sampling profiler.
+//
+// A SIGPROF timer (setitimer ITIMER_PROF) interrupts whichever thread is
+// consuming cpu.  The handler walks the frame pointer chain of the
+// interrupted thread and writes the return addresses into a preallocated
+// ProfileSample slot.  Symbolization happens later, outside of the handler,
+// using lookup_address which knows about the loaded libraries and the
+// objects registered by the JIT (register_jitted_object).
+// The samples are written as "folded stacks" (frame;frame;frame count)
+// which is what src/profiler/flame and flamegraph.pl consume.
+//
+
+#include <signal.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <cxxabi.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <fstream>
+#include <clasp/core/foundation.h>
+#include <clasp/core/object.h>
+#include <clasp/core/lisp.h>
+#include <clasp/core/array.h>
+#include <clasp/core/debugger.h>
+#include <clasp/core/sampleProfiler.h>
+#include <clasp/core/wrappers.h>
+
+namespace core {
+
+SampleProfiler global_SampleProfiler;
+
+/*! Extract the pc, frame pointer and stack pointer of the interrupted context */
+static inline bool sample_context_registers(void* context, uintptr_t& pc, uintptr_t& fp, uintptr_t& sp) {
+  ucontext_t* uc = (ucontext_t*)context;
+#if defined(_TARGET_OS_DARWIN) && defined(__x86_64__)
+  pc = (uintptr_t)uc->uc_mcontext->__ss.__rip;
+  fp = (uintptr_t)uc->uc_mcontext->__ss.__rbp;
+  sp = (uintptr_t)uc->uc_mcontext->__ss.__rsp;
+  return true;
+#elif defined(_TARGET_OS_LINUX) && defined(__x86_64__)
+  pc = (uintptr_t)uc->uc_mcontext.gregs[REG_RIP];
+  fp = (uintptr_t)uc->uc_mcontext.gregs[REG_RBP];
+  sp = (uintptr_t)uc->uc_mcontext.gregs[REG_RSP];
+  return true;
+#elif defined(_TARGET_OS_FREEBSD) && defined(__x86_64__)
+  pc = (uintptr_t)uc->uc_mcontext.mc_rip;
+  fp = (uintptr_t)uc->uc_mcontext.mc_rbp;
+  sp = (uintptr_t)uc->uc_mcontext.mc_rsp;
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*! Record one sample of the interrupted context into SAMPLES */
+static void sample_profiler_record(SampleProfiler& prof, ProfileSample* samples, void* context) {
+  size_t index = prof._NextSample.fetch_add(1, std::memory_order_relaxed);
+  if (index >= prof._MaxSamples) {
+    prof._DroppedSamples.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  ProfileSample& sample = samples[index];
+  uintptr_t pc, fp, sp;
+  uint32_t depth = 0;
+  if (sample_context_registers(context, pc, fp, sp)) {
+    uintptr_t stackTop = (uintptr_t)my_thread_low_level->_StackTop;
+    sample._Frames[depth++] = pc;
+    while (depth < SAMPLE_PROFILER_MAX_DEPTH && fp >= sp && fp < stackTop && (fp & (sizeof(uintptr_t) - 1)) == 0) {
+      uintptr_t ret = ((uintptr_t*)fp)[1];
+      if (!ret) break;
+      sample._Frames[depth++] = ret;
+      uintptr_t next = ((uintptr_t*)fp)[0];
+      if (next <= fp) break; // The stack grows down - frames must move toward the cold end
+      fp = next;
+    }
+  } else {
+    // Unknown architecture - record the handler's own frame so the sample still counts
+    sample._Frames[depth++] = (uintptr_t)__builtin_return_address(0);
+  }
+  sample._Thread = (uintptr_t)pthread_self();
+  sample._Depth.store(depth, std::memory_order_release);
+}
+
+/*! The SIGPROF handler - it must be async-signal-safe.
+    It doesn't allocate, doesn't take locks and only reads
+    memory between the interrupted stack pointer and the cold end of the stack.
+    It is counted in _ActiveHandlers before it looks at the buffer so that
+    stopping and resetting can wait for it to finish. */
+static void sample_profiler_handler(int signo, siginfo_t* info, void* context) {
+  SampleProfiler& prof = global_SampleProfiler;
+  // Threads that clasp didn't start have no stack bounds - ignore them
+  if (!my_thread_low_level || !my_thread_low_level->_StackTop) return;
+  int saved_errno = errno;
+  prof._ActiveHandlers.fetch_add(1);
+  if (prof._Enabled.load()) {
+    ProfileSample* samples = prof._Samples.load();
+    if (samples) sample_profiler_record(prof, samples, context);
+  }
+  prof._ActiveHandlers.fetch_sub(1);
+  errno = saved_errno;
+}
+
+/*! Wait for the SIGPROF handlers that are running on other threads to finish */
+static void sample_profiler_wait_for_handlers() {
+  SampleProfiler& prof = global_SampleProfiler;
+  while (prof._ActiveHandlers.load() != 0) sched_yield();
+}
+
+static void sample_profiler_set_timer(size_t frequency) {
+  struct itimerval timer;
+  if (frequency == 0) {
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 0;
+  } else {
+    size_t usec = 1000000 / frequency;
+    timer.it_interval.tv_sec = usec / 1000000;
+    timer.it_interval.tv_usec = usec % 1000000;
+  }
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, NULL) != 0) {
+    SIMPLE_ERROR(BF("Could not set the profiling timer - %s") % strerror(errno));
+  }
+}
+
+static void sample_profiler_install_handler() {
+  SampleProfiler& prof = global_SampleProfiler;
+  if (prof._HandlerInstalled) return;
+  struct sigaction new_action;
+  new_action.sa_sigaction = sample_profiler_handler;
+  sigemptyset(&new_action.sa_mask);
+  new_action.sa_flags = SA_RESTART | SA_SIGINFO;
+  if (sigaction(SIGPROF, &new_action, NULL) != 0) {
+    SIMPLE_ERROR(BF("Could not register the SIGPROF signal-handler - %s") % strerror(errno));
+  }
+  prof._HandlerInstalled = true;
+}
+
+CL_LAMBDA(&key (frequency 97) (max-samples 100000));
+CL_DOCSTRING(R"doc(Start the statistical sampling profiler. FREQUENCY is the number of samples per second of cpu time
+and MAX-SAMPLES is the size of the preallocated sample buffer. Samples accumulate until
+SAMPLING-PROFILER-RESET is called.)doc");
+CL_DEFUN void core__sampling_profiler_start(size_t frequency, size_t max_samples) {
+  SampleProfiler& prof = global_SampleProfiler;
+  if (prof._Enabled.load()) {
+    SIMPLE_ERROR(BF("The sampling profiler is already running"));
+  }
+  if (frequency == 0 || frequency > 100000) {
+    SIMPLE_ERROR(BF("Illegal sampling frequency %lu") % frequency);
+  }
+  if (prof._Samples.load() && prof._MaxSamples != max_samples) {
+    core__sampling_profiler_reset();
+  }
+  if (!prof._Samples.load()) {
+    ProfileSample* samples = (ProfileSample*)calloc(max_samples, sizeof(ProfileSample));
+    if (!samples) {
+      SIMPLE_ERROR(BF("Could not allocate %lu profile samples") % max_samples);
+    }
+    prof._MaxSamples = max_samples;
+    prof._NextSample.store(0);
+    prof._DroppedSamples.store(0);
+    prof._Samples.store(samples);
+  }
+  prof._Frequency = frequency;
+  sample_profiler_install_handler();
+  prof._Enabled.store(true);
+  sample_profiler_set_timer(frequency);
+}
+
+CL_DOCSTRING("Stop the statistical sampling profiler. The samples are kept.");
+CL_DEFUN void core__sampling_profiler_stop() {
+  SampleProfiler& prof = global_SampleProfiler;
+  if (!prof._Enabled.load()) return;
+  sample_profiler_set_timer(0);
+  prof._Enabled.store(false);
+  // A signal delivered before the timer stopped may still be in a handler
+  sample_profiler_wait_for_handlers();
+}
+
+CL_DOCSTRING("Discard all samples collected by the sampling profiler and release the sample buffer.");
+CL_DEFUN void core__sampling_profiler_reset() {
+  SampleProfiler& prof = global_SampleProfiler;
+  if (prof._Enabled.load()) {
+    SIMPLE_ERROR(BF("Stop the sampling profiler before resetting it"));
+  }
+  // Keep this thread's handler out while the buffer is swapped out, then
+  // wait for the handlers on other threads before it is freed
+  sigset_t block, saved;
+  sigemptyset(&block);
+  sigaddset(&block, SIGPROF);
+  pthread_sigmask(SIG_BLOCK, &block, &saved);
+  ProfileSample* samples = prof._Samples.exchange(NULL);
+  sample_profiler_wait_for_handlers();
+  pthread_sigmask(SIG_SETMASK, &saved, NULL);
+  if (samples) free(samples);
+  prof._MaxSamples = 0;
+  prof._NextSample.store(0);
+  prof._DroppedSamples.store(0);
+}
+
+CL_DOCSTRING("Return (values running-p number-of-samples dropped-samples frequency) for the sampling profiler.");
+CL_DEFUN T_mv core__sampling_profiler_info() {
+  SampleProfiler& prof = global_SampleProfiler;
+  size_t num = std::min(prof._NextSample.load(), prof._MaxSamples);
+  return Values(_lisp->_boolean(prof._Enabled.load()),
+                make_fixnum(num),
+                make_fixnum(prof._DroppedSamples.load()),
+                make_fixnum(prof._Frequency));
+}
+
+/*! Return a name for the code at address that can be used in a folded stack.
+    Jitted code is found through the objects registered with register_jitted_object. */
+static std::string sample_frame_name(uintptr_t address) {
+  const char* symbol;
+  uintptr_t start, end;
+  char type;
+  std::string name;
+  if (lookup_address(address, symbol, start, end, type)) {
+    int status;
+    char* demangled = abi::__cxa_demangle(symbol, NULL, NULL, &status);
+    if (status == 0 && demangled) {
+      name = demangled;
+      free(demangled);
+    } else {
+      name = symbol;
+    }
+  } else {
+    stringstream ss;
+    ss << "0x" << std::hex << address;
+    name = ss.str();
+  }
+  // ';' separates frames and the count follows the last space in a folded stack
+  for (auto& c : name) {
+    if (c == ';') c = ':';
+    else if (c == '\n') c = ' ';
+  }
+  return name;
+}
+
+static void sample_profiler_fold(std::map<std::string, size_t>& folded, bool per_thread) {
+  SampleProfiler& prof = global_SampleProfiler;
+  std::map<uintptr_t, std::string> names;
+  ProfileSample* samples = prof._Samples.load();
+  if (!samples) return;
+  size_t num = std::min(prof._NextSample.load(), prof._MaxSamples);
+  for (size_t i = 0; i < num; ++i) {
+    ProfileSample& sample = samples[i];
+    uint32_t depth = sample._Depth.load(std::memory_order_acquire);
+    if (depth == 0) continue; // never completed
+    stringstream ss;
+    if (per_thread) {
+      ss << "thread-" << std::hex << sample._Thread << std::dec;
+    }
+    // Folded stacks are written from the root to the leaf
+    for (int j = depth - 1; j >= 0; --j) {
+      // Return addresses point after the call - back up one byte to stay inside the caller
+      uintptr_t address = (j == 0) ? sample._Frames[j] : sample._Frames[j] - 1;
+      auto it = names.find(address);
+      if (it == names.end()) {
+        it = names.emplace(address, sample_frame_name(address)).first;
+      }
+      if (ss.tellp() > 0) ss << ";";
+      ss << it->second;
+    }
+    folded[ss.str()]++;
+  }
+}
+
+CL_LAMBDA(&optional per-thread);
+CL_DOCSTRING(R"doc(Return an alist of (folded-stack . count) for the samples collected by the sampling profiler.
+If PER-THREAD is true then each stack is prefixed with the thread that was sampled.)doc");
+CL_DEFUN List_sp core__sampling_profiler_folded_stacks(bool per_thread) {
+  std::map<std::string, size_t> folded;
+  sample_profiler_fold(folded, per_thread);
+  ql::list result;
+  for (auto entry : folded) {
+    result << Cons_O::create(SimpleBaseString_O::make(entry.first), make_fixnum(entry.second));
+  }
+  return result.cons();
+}
+
+CL_LAMBDA(filename &optional per-thread);
+CL_DOCSTRING(R"doc(Write the samples collected by the sampling profiler to FILENAME as folded stacks
+that can be passed to src/profiler/flame or flamegraph.pl. Return the number of distinct stacks.)doc");
+CL_DEFUN size_t core__sampling_profiler_write_folded(const std::string& filename, bool per_thread) {
+  std::map<std::string, size_t> folded;
+  sample_profiler_fold(folded, per_thread);
+  std::ofstream fout(filename);
+  if (!fout.good()) {
+    SIMPLE_ERROR(BF("Could not open file %s - %s") % filename % strerror(errno));
+  }
+  for (auto entry : folded) {
+    fout << entry.first << " " << entry.second << std::endl;
+  }
+  fout.close();
+  return folded.size();
+}
+
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_start);
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_stop);
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_reset);
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_info);
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_folded_stacks);
+SYMBOL_EXPORT_SC_(CorePkg, sampling_profiler_write_folded);
+
+};
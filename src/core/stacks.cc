@@ -198,7 +198,9 @@ DONT_OPTIMIZE_WHEN_DEBUG_RELEASE SimpleVector_sp InvocationHistoryFrame::argumen
   va_list cargs;
   va_copy(cargs,this->_args);
   T_O* objRaw;
-  if (numberOfArguments > CALL_ARGUMENTS_LIMIT) {
+  // Calls through APPLY can pass more than CALL_ARGUMENTS_LIMIT arguments,
+  // only a count beyond any real call means the frame is damaged
+  if (numberOfArguments > APPLY_ARGUMENTS_SANITY_LIMIT) {
     va_end(cargs);
     return SimpleVector_O::make(0);
   }
@@ -86,6 +86,9 @@ typedef int mode_t;
 #endif
 #include <fcntl.h>
 #include <errno.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <clasp/core/pathname.h>
 #include <clasp/core/array.h>
@@ -1136,6 +1139,299 @@ string_match(const char *s, T_sp pattern) {
   }
 }
 
+#if defined(HAVE_DIRENT_H)
+/*
+ * The directory walker reads directories with readdir and uses d_type to
+ * classify entries so that regular files and directories never need a
+ * stat.  Entries are filtered on their raw names before any pathname is
+ * built.  Listings are plain C++ data so they can be read by worker threads
+ * that never touch the Lisp heap - when DIRECTORY hits :WILD-INFERIORS the
+ * whole subtree is read in parallel first and the Lisp side then only
+ * builds pathnames for the entries that survive the masks.
+ */
+struct RawDirEntry {
+  std::string _Name;
+  unsigned char _Type;
+  RawDirEntry(const char* name, unsigned char type) : _Name(name), _Type(type) {};
+};
+
+struct RawDirListing {
+  time_t _Mtime;
+  long _MtimeNsec;
+  std::vector<RawDirEntry> _Entries;
+};
+
+/*! Listings read ahead of time for one call to DIRECTORY, keyed by the
+    directory namestring (with its trailing separator). */
+struct RawDirectoryTree {
+  std::mutex _Mutex;
+  std::map<std::string, RawDirListing> _Listings;
+  const RawDirListing* find(const std::string& dirname) {
+    std::lock_guard<std::mutex> guard(this->_Mutex);
+    auto it = this->_Listings.find(dirname);
+    return (it == this->_Listings.end()) ? NULL : &it->second;
+  }
+};
+
+static size_t global_directory_walk_threads = 0;
+static bool global_directory_cache_enabled = false;
+static std::mutex global_directory_cache_mutex;
+static std::map<std::string, RawDirListing> global_directory_cache;
+/* The listing cache is emptied when it holds this many directories */
+#define DIRECTORY_CACHE_LIMIT 4096
+
+static bool stat_mtime(const std::string& dirname, time_t& mtime, long& nsec) {
+  struct stat buf;
+  if (safe_stat(dirname.c_str(), &buf) < 0) return false;
+  mtime = buf.st_mtime;
+#if defined(_TARGET_OS_LINUX)
+  nsec = buf.st_mtim.tv_nsec;
+#elif defined(_TARGET_OS_DARWIN)
+  nsec = buf.st_mtimespec.tv_nsec;
+#else
+  nsec = 0;
+#endif
+  return true;
+}
+
+/*! Read the entries of DIRNAME (skipping . and ..).  Never allocates in
+    the Lisp heap so it may be called from a worker thread. */
+static bool read_raw_directory(const std::string& dirname, RawDirListing& listing) {
+  DIR* dir = opendir(dirname.c_str());
+  if (dir == NULL) return false;
+  struct dirent* entry;
+  while ((entry = readdir(dir))) {
+    const char* text = entry->d_name;
+    if (text[0] == '.' &&
+        (text[1] == '\0' ||
+         (text[1] == '.' && text[2] == '\0')))
+      continue;
+    unsigned char type = entry->d_type;
+    if (type == DT_UNKNOWN) {
+      // Some filesystems don't fill in d_type
+      struct stat buf;
+      std::string path = dirname + text;
+      if (lstat(path.c_str(), &buf) == 0) {
+        if (S_ISDIR(buf.st_mode)) type = DT_DIR;
+        else if (S_ISREG(buf.st_mode)) type = DT_REG;
+        else if (S_ISLNK(buf.st_mode)) type = DT_LNK;
+      }
+    }
+    listing._Entries.emplace_back(text, type);
+  }
+  closedir(dir);
+  return true;
+}
+
+/*! Read DIRNAME, going through the listing cache when it is enabled.
+    A cached listing is used only while the directory mtime is unchanged. */
+static bool raw_directory_listing(const std::string& dirname, RawDirListing& listing) {
+  if (!global_directory_cache_enabled) {
+    return read_raw_directory(dirname, listing);
+  }
+  time_t mtime;
+  long nsec;
+  if (!stat_mtime(dirname, mtime, nsec)) return false;
+  {
+    std::lock_guard<std::mutex> guard(global_directory_cache_mutex);
+    auto it = global_directory_cache.find(dirname);
+    if (it != global_directory_cache.end() &&
+        it->second._Mtime == mtime &&
+        it->second._MtimeNsec == nsec) {
+      listing = it->second;
+      return true;
+    }
+  }
+  listing._Mtime = mtime;
+  listing._MtimeNsec = nsec;
+  if (!read_raw_directory(dirname, listing)) return false;
+  std::lock_guard<std::mutex> guard(global_directory_cache_mutex);
+  if (global_directory_cache.size() >= DIRECTORY_CACHE_LIMIT &&
+      global_directory_cache.find(dirname) == global_directory_cache.end()) {
+    // Walks over huge trees would otherwise keep every listing forever
+    global_directory_cache.clear();
+  }
+  global_directory_cache[dirname] = listing;
+  return true;
+}
+
+/*! Return the truename of the directory DIRNAME (with its trailing
+    separator), or DIRNAME itself if it can't be resolved or FLAGS doesn't
+    ask for symlinks to be followed.  Entries read from a resolved directory
+    are truenames without stat'ing each one. */
+static std::string resolve_directory_name(const std::string& dirname, int flags) {
+  if (!(flags & FOLLOW_SYMLINKS)) return dirname;
+  char buffer[PATH_MAX];
+  if (realpath(dirname.c_str(), buffer) == NULL) return dirname;
+  std::string resolved(buffer);
+  if (resolved.empty() || resolved.back() != DIR_SEPARATOR_CHAR) resolved += DIR_SEPARATOR;
+  return resolved;
+}
+
+/* Trees with fewer directories than this are read on the calling thread */
+#define DIRECTORY_WALK_SERIAL_LIMIT 64
+
+/*! Read every directory below ROOT into TREE.
+    The first DIRECTORY_WALK_SERIAL_LIMIT directories are read on the
+    calling thread, only a larger tree gets a pool of threads.
+    Only real directories (not symlinks) are descended, which is what
+    dir_recursive does with :WILD-INFERIORS. */
+static void read_raw_directory_tree(const std::string& root, RawDirectoryTree& tree) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::string> work;
+  size_t busy = 0;
+  size_t directories_read = 0;
+  work.push_back(root);
+  auto worker = [&](size_t limit) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      cv.wait(lock, [&] { return !work.empty() || busy == 0; });
+      if (work.empty() || directories_read >= limit) return;
+      std::string dirname = work.back();
+      work.pop_back();
+      ++busy;
+      ++directories_read;
+      lock.unlock();
+      RawDirListing listing;
+      bool ok = raw_directory_listing(dirname, listing);
+      std::vector<std::string> subdirs;
+      if (ok) {
+        for (auto& entry : listing._Entries) {
+          if (entry._Type == DT_DIR) subdirs.push_back(dirname + entry._Name + DIR_SEPARATOR);
+        }
+        std::lock_guard<std::mutex> guard(tree._Mutex);
+        tree._Listings[dirname] = std::move(listing);
+      }
+      lock.lock();
+      --busy;
+      for (auto& subdir : subdirs) work.push_back(subdir);
+      cv.notify_all();
+    }
+  };
+  worker(DIRECTORY_WALK_SERIAL_LIMIT);
+  if (work.empty()) return;
+  size_t nthreads = global_directory_walk_threads ? global_directory_walk_threads : std::thread::hardware_concurrency();
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < nthreads; ++i) threads.emplace_back(worker, SIZE_MAX);
+  worker(SIZE_MAX);
+  for (auto& thread : threads) thread.join();
+}
+
+/*! A mask on raw entry names.  Literal strings are compared directly,
+    only wild strings go through clasp_stringMatch. */
+struct RawNameMask {
+  enum { any, literal, wild } _Kind;
+  std::string _Literal;
+  T_sp _Pattern;
+  RawNameMask(T_sp pattern) : _Pattern(pattern) {
+    if (pattern.nilp() || pattern == kw::_sym_wild) {
+      this->_Kind = any;
+    } else if (cl__stringp(pattern) && !clasp_wild_string_p(pattern)) {
+      this->_Kind = literal;
+      this->_Literal = gc::As_unsafe<String_sp>(pattern)->get_std_string();
+    } else {
+      this->_Kind = wild;
+    }
+  }
+  bool match(const std::string& name) const {
+    switch (this->_Kind) {
+    case any: return true;
+    case literal: return name == this->_Literal;
+    default: return string_match(name.c_str(), this->_Pattern);
+    }
+  }
+};
+
+/*! Reject names that can't match the literal type of a pathname mask
+    before a pathname is parsed for them. */
+static bool raw_type_may_match(const std::string& name, const std::string& type) {
+  if (name.size() < type.size() + 2) return false;
+  size_t dot = name.size() - type.size() - 1;
+  return name[dot] == '.' && name.compare(dot + 1, std::string::npos, type) == 0;
+}
+
+static T_sp
+list_directory(T_sp base_dir, T_sp text_mask, T_sp pathname_mask, int flags, RawDirectoryTree* tree) {
+  T_sp out = _Nil<T_O>();
+  if (base_dir.nilp()) SIMPLE_ERROR(BF("%s is about to pass NIL to clasp_namestring") % __FUNCTION__);
+  T_sp prefix = clasp_namestring(base_dir, CLASP_NAMESTRING_FORCE_BASE_STRING);
+  std::string sprefix = gc::As<String_sp>(prefix)->get_std_string();
+  RawDirListing local_listing;
+  // Listings in a tree were read below a root that was already resolved
+  const RawDirListing* listing = tree ? tree->find(sprefix) : NULL;
+  std::string sdirectory = sprefix;
+  if (!listing) {
+    clasp_disable_interrupts();
+    bool ok = raw_directory_listing(sprefix, local_listing);
+    if (ok) sdirectory = resolve_directory_name(sprefix, flags);
+    clasp_enable_interrupts();
+    if (!ok) return out;
+    listing = &local_listing;
+  }
+  RawNameMask name_mask(text_mask);
+  bool check_type = false;
+  std::string literal_type;
+  if (pathname_mask.notnilp()) {
+    T_sp type = gc::As<Pathname_sp>(pathname_mask)->_Type;
+    if (cl__stringp(type) && !clasp_wild_string_p(type)) {
+      check_type = true;
+      literal_type = gc::As_unsafe<String_sp>(type)->get_std_string();
+    }
+  }
+  for (auto& entry : listing->_Entries) {
+    if (!name_mask.match(entry._Name))
+      continue;
+    if (check_type && entry._Type != DT_DIR && !raw_type_may_match(entry._Name, literal_type))
+      continue;
+    std::string filename = sprefix + entry._Name;
+    T_sp component = SimpleBaseString_O::make(filename);
+    T_sp component_path;
+    T_sp kind;
+    if (!pathname_mask.nilp()) {
+      if (!cl__pathname_match_p(component, pathname_mask)) // should this not be inverted?
+        continue;
+    }
+    if (entry._Type == DT_REG) {
+      // Under the resolved directory a regular file is its own truename
+      component_path = cl__pathname(SimpleBaseString_O::make(sdirectory + entry._Name));
+      gc::As_unsafe<Pathname_sp>(component_path)->_Version = kw::_sym_newest;
+      kind = kw::_sym_file;
+    } else if (entry._Type == DT_DIR) {
+      component_path = cl__pathname(SimpleBaseString_O::make(sdirectory + entry._Name + DIR_SEPARATOR));
+      gc::As_unsafe<Pathname_sp>(component_path)->_Version = _Nil<T_O>();
+      kind = kw::_sym_directory;
+    } else {
+      T_mv component_path_mv = file_truename(cl__pathname(component), component, flags);
+      component_path = component_path_mv;
+      kind = component_path_mv.valueGet_(1);
+    }
+    out = Cons_O::create(Cons_O::create(component_path, kind), out);
+  }
+  return cl__nreverse(out);
+}
+
+CL_LAMBDA(threads);
+CL_DECLARE();
+CL_DOCSTRING("Set the number of threads DIRECTORY uses to read a large tree for :WILD-INFERIORS - 0 means one per core.  Small trees are always read on the calling thread.  Returns the previous value.");
+CL_DEFUN size_t core__set_directory_walk_threads(size_t threads) {
+  size_t old = global_directory_walk_threads;
+  global_directory_walk_threads = threads;
+  return old;
+}
+
+CL_LAMBDA(enable);
+CL_DECLARE();
+CL_DOCSTRING("Enable or disable caching of directory listings for DIRECTORY.  A cached listing is reused while the modification time of its directory is unchanged.  The cache is emptied when it fills up with listings of 4096 directories.  Disabling the cache empties it.");
+CL_DEFUN void core__directory_listing_cache(bool enable) {
+  std::lock_guard<std::mutex> guard(global_directory_cache_mutex);
+  global_directory_cache_enabled = enable;
+  if (!enable) global_directory_cache.clear();
+}
+
+#else // !HAVE_DIRENT_H
+struct RawDirectoryTree;
+
 /*
  * list_current_directory() lists the files and directories which are contained
  * in the current working directory (as given by current_dir()). If ONLY_DIR is
@@ -1143,7 +1439,7 @@ string_match(const char *s, T_sp pattern) {
  * by following the symlinks.
  */
 static T_sp
-list_directory(T_sp base_dir, T_sp text_mask, T_sp pathname_mask, int flags) {
+list_directory(T_sp base_dir, T_sp text_mask, T_sp pathname_mask, int flags, RawDirectoryTree* tree) {
   T_sp out = _Nil<T_O>();
   if (base_dir.nilp()) SIMPLE_ERROR(BF("%s is about to pass NIL to clasp_namestring") % __FUNCTION__);
   T_sp prefix = clasp_namestring(base_dir, CLASP_NAMESTRING_FORCE_BASE_STRING);
@@ -1247,6 +1543,7 @@ list_directory(T_sp base_dir, T_sp text_mask, T_sp pathname_mask, int flags) {
 OUTPUT:
   return cl__nreverse(out);
 }
+#endif // HAVE_DIRENT_H
 
 CL_LAMBDA(template);
 CL_DECLARE();
@@ -1533,7 +1830,7 @@ CL_DEFUN T_sp core__copy_file(T_sp orig, T_sp dest) {
  * used to build these pathnames.
  */
 static T_sp
-dir_files(T_sp base_dir, T_sp tpathname, int flags) {
+dir_files(T_sp base_dir, T_sp tpathname, int flags, RawDirectoryTree* tree) {
   T_sp all_files, output = _Nil<T_O>();
   T_sp mask;
   Pathname_sp pathname = gc::As<Pathname_sp>(tpathname);
@@ -1549,7 +1846,7 @@ dir_files(T_sp base_dir, T_sp tpathname, int flags) {
                          type, true,
                          pathname->_Version, true,
                          kw::_sym_local);
-  for (all_files = list_directory(base_dir, _Nil<T_O>(), mask, flags);
+  for (all_files = list_directory(base_dir, _Nil<T_O>(), mask, flags, tree);
        !all_files.nilp();
        all_files = oCdr(all_files)) {
     T_sp record = oCar(all_files);
@@ -1569,8 +1866,11 @@ dir_files(T_sp base_dir, T_sp tpathname, int flags) {
  * list.
  */
 static T_sp
-dir_recursive(T_sp base_dir, T_sp directory, T_sp filemask, int flags) {
+dir_recursive(T_sp base_dir, T_sp directory, T_sp filemask, int flags, RawDirectoryTree* tree) {
   T_sp item, output = _Nil<T_O>();
+#if defined(HAVE_DIRENT_H)
+  RawDirectoryTree subtree;
+#endif
 AGAIN:
   /* There are several possibilities here:
      *
@@ -1580,7 +1880,7 @@ AGAIN:
      * we have to find a file which corresponds to the description.
      */
   if (directory.nilp()) {
-    return clasp_nconc(dir_files(base_dir, filemask, flags), output);
+    return clasp_nconc(dir_files(base_dir, filemask, flags, tree), output);
   }
   /*
      * 2) We have not yet exhausted the DIRECTORY component of the
@@ -1594,7 +1894,7 @@ AGAIN:
          * 2.1) If CAR(DIRECTORY) is a string or :WILD, we have to
          * enter & scan all subdirectories in our curent directory.
          */
-    T_sp next_dir = list_directory(base_dir, item, _Nil<T_O>(), flags);
+    T_sp next_dir = list_directory(base_dir, item, _Nil<T_O>(), flags, tree);
     for (; !next_dir.nilp(); next_dir = oCdr(next_dir)) {
       T_sp record = oCar(next_dir);
       T_sp component = oCar(record);
@@ -1604,7 +1904,7 @@ AGAIN:
       if (component.nilp()) SIMPLE_ERROR(BF("%s was about to pass nil to pathname") % __FUNCTION__);
       item = dir_recursive(cl__pathname(component),
                            oCdr(directory),
-                           filemask, flags);
+                           filemask, flags, tree);
       output = clasp_nconc(item, output);
     }
   } else if (item == kw::_sym_wild_inferiors) {
@@ -1613,7 +1913,19 @@ AGAIN:
          * scan all subdirectories from _all_ levels, looking for a
          * tree that matches the remaining part of DIRECTORY.
          */
-    T_sp next_dir = list_directory(base_dir, _Nil<T_O>(), _Nil<T_O>(), flags);
+#if defined(HAVE_DIRENT_H)
+    /* Read the whole subtree up front with the worker threads, unless an
+         * enclosing :WILD-INFERIORS already did. */
+    if (!tree) {
+      T_sp prefix = clasp_namestring(base_dir, CLASP_NAMESTRING_FORCE_BASE_STRING);
+      std::string sprefix = gc::As<String_sp>(prefix)->get_std_string();
+      std::string root = resolve_directory_name(sprefix, flags);
+      if (root != sprefix) base_dir = cl__pathname(SimpleBaseString_O::make(root));
+      read_raw_directory_tree(root, subtree);
+      tree = &subtree;
+    }
+#endif
+    T_sp next_dir = list_directory(base_dir, _Nil<T_O>(), _Nil<T_O>(), flags, tree);
     for (; !next_dir.nilp(); next_dir = oCdr(next_dir)) {
       T_sp record = oCar(next_dir);
       T_sp component = oCar(record);
@@ -1622,7 +1934,7 @@ AGAIN:
         continue;
       if (component.nilp()) SIMPLE_ERROR(BF("%s was about to pass nil to pathname") % __FUNCTION__);
       item = dir_recursive(cl__pathname(component),
-                           directory, filemask, flags);
+                           directory, filemask, flags, tree);
       output = clasp_nconc(item, output);
     }
     directory = oCdr(directory);
@@ -1657,7 +1969,7 @@ CL_DEFUN T_sp cl__directory(T_sp mask, T_sp resolveSymlinks) {
   mask = make_absolute_pathname(mask); // in this file
   base_dir = make_base_pathname(gc::As<Pathname_sp>(mask));
   output = dir_recursive(base_dir, cl__pathname_directory(mask), mask,
-                         resolveSymlinks.nilp() ? 0 : FOLLOW_SYMLINKS);
+                         resolveSymlinks.nilp() ? 0 : FOLLOW_SYMLINKS, NULL);
   return output;
 };
 
@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <clasp/gctools/gctoolsPackage.h>
 #ifdef USE_BOEHM // whole file #ifdef USE_BOEHM
 #include <clasp/gctools/boehmGarbageCollection.h>
+#include <clasp/gctools/gc_boot.h>
 #include <clasp/core/debugger.h>
 
 
@@ -247,6 +248,196 @@ void* boehm_create_shadow_table(size_t nargs)
 };
 
 namespace gctools {
+
+int global_boehm_precise_kind = 0;
+unsigned char* global_boehm_precise_stamps = NULL;
+size_t global_boehm_precise_stamps_max = 0;
+
+/*! Push one field of an object onto the mark stack.
+    Tagged general and cons pointers are untagged, raw pointers are pushed as they
+    are and immediates (odd fixnums, characters, single-floats) are skipped.
+    GC_MARK_AND_PUSH ignores anything that doesn't point into the heap. */
+static inline struct GC_ms_entry* boehm_mark_field(const void* field_address, struct GC_ms_entry* msp, struct GC_ms_entry* msl) {
+  uintptr_clasp_t value = *reinterpret_cast<const uintptr_clasp_t*>(field_address);
+  if ((value & pointer_tag_mask) == pointer_tag_eq) {
+    value &= ptr_mask;
+  } else if (value & tag_mask) {
+    return msp;
+  }
+  return GC_MARK_AND_PUSH((void*)value, msp, msl, (void**)field_address);
+}
+
+static struct GC_ms_entry* boehm_mark_conservatively(GC_word* addr, struct GC_ms_entry* msp, struct GC_ms_entry* msl) {
+  size_t words = GC_size(addr)/sizeof(GC_word);
+  for ( size_t i=0; i<words; ++i ) {
+    msp = GC_MARK_AND_PUSH((void*)addr[i], msp, msl, (void**)&addr[i]);
+  }
+  return msp;
+}
+
+/*! The mark procedure for the precise object kind.
+    This walks the same field and container layouts that obj_scan uses for MPS.
+    An object whose header hasn't been written yet, or whose stamp has no
+    usable layout, is scanned conservatively. */
+struct GC_ms_entry* boehm_precise_mark_proc(GC_word* addr, struct GC_ms_entry* msp, struct GC_ms_entry* msl, GC_word env) {
+  const Header_s& header = *reinterpret_cast<const Header_s*>(addr);
+  if (!header.stampP()) return boehm_mark_conservatively(addr,msp,msl);
+  GCStampEnum stamp = header.stamp();
+  if (!boehm_precise_stamp_p(stamp)) return boehm_mark_conservatively(addr,msp,msl);
+  const char* client = reinterpret_cast<const char*>(addr) + sizeof(Header_s);
+  const Stamp_layout& stamp_layout = global_stamp_layout[stamp];
+  if ( stamp_layout.field_layout_start ) {
+    const Field_layout* field_layout_cur = stamp_layout.field_layout_start;
+    for ( int i=0; i<stamp_layout.number_of_fields; ++i ) {
+      msp = boehm_mark_field(client + field_layout_cur->field_offset, msp, msl);
+      ++field_layout_cur;
+    }
+  }
+  if ( stamp_layout.container_layout ) {
+    const Container_layout& container_layout = *stamp_layout.container_layout;
+    size_t end = *(size_t*)(client + stamp_layout.end_offset);
+    for ( size_t i=0; i<end; ++i ) {
+      const Field_layout* field_layout_cur = container_layout.field_layout_start;
+      const char* element = client + stamp_layout.data_offset + stamp_layout.element_size*i;
+      for ( int j=0; j<container_layout.number_of_fields; ++j ) {
+        msp = boehm_mark_field(element + field_layout_cur->field_offset, msp, msl);
+        ++field_layout_cur;
+      }
+    }
+  }
+  return msp;
+}
+
+static bool boehm_pointer_field_code_p(const Layout_code& code) {
+  return (code.cmd == fixed_field || code.cmd == variable_field)
+    && (code.data0 == SMART_PTR_OFFSET
+        || code.data0 == TAGGED_POINTER_OFFSET
+        || code.data0 == POINTER_OFFSET);
+}
+
+/*! clasp_gc.cc is written by the static analyzer and may be older than the
+    C++ it describes.  Check the pointer fields of every stamp against the sizes
+    the compiler gives: a pointer field must be one aligned word that lies inside
+    its object, or inside a container element.  Stamps that fail are left
+    conservative.  Returns the number of stamps that failed. */
+static size_t boehm_check_stamp_layouts(unsigned char* stamps) {
+  Layout_code* codes = get_stamp_layout_codes();
+  size_t failed = 0;
+  size_t stamp = 0;
+  size_t object_size = 0;
+  size_t element_size = 0;
+  bool in_container = false;
+  for ( size_t idx=0; codes[idx].cmd != layout_end; ++idx ) {
+    const Layout_code& code = codes[idx];
+    switch (code.cmd) {
+    case class_kind:
+    case container_kind:
+    case bitunit_container_kind:
+    case templated_kind:
+        stamp = code.data0;
+        object_size = code.data1;
+        in_container = false;
+        break;
+    case variable_capacity:
+        element_size = code.data0;
+        in_container = true;
+        break;
+    default: {
+        if ( !boehm_pointer_field_code_p(code) || !stamps[stamp] ) break;
+        size_t limit = in_container ? element_size : object_size;
+        size_t offset = code.data2;
+        if ( code.data1 != sizeof(void*)
+             || offset % sizeof(void*) != 0
+             || offset + code.data1 > limit ) {
+          if (failed < 10) {
+            fprintf(stderr,"%s:%d The layout of %s field %s (size %lu offset %lu) does not fit the object (size %lu) - clasp_gc.cc may be stale, marking it conservatively\n",
+                    __FILE__, __LINE__, global_stamp_info[stamp].name, code.description,
+                    (unsigned long)code.data1, (unsigned long)offset, (unsigned long)limit);
+          }
+          stamps[stamp] = 0;
+          ++failed;
+        }
+      }
+    }
+  }
+  return failed;
+}
+
+/*! Decide which stamps can be marked precisely and create the object kind.
+    Only class and container stamps described by the layout codes qualify -
+    templated and bitunit objects and DerivableCxxObject are left conservative. */
+void boehm_initialize_precise_marking() {
+  global_boehm_precise_stamps_max = global_stamp_max;
+  unsigned char* stamps = (unsigned char*)calloc(global_stamp_max+1,sizeof(unsigned char));
+  Layout_code* codes = get_stamp_layout_codes();
+  for ( size_t idx=0; codes[idx].cmd != layout_end; ++idx ) {
+    if ( codes[idx].cmd == class_kind || codes[idx].cmd == container_kind ) {
+      stamps[codes[idx].data0] = 1;
+    } else if ( codes[idx].cmd == templated_kind || codes[idx].cmd == bitunit_container_kind ) {
+      stamps[codes[idx].data0] = 0;
+    }
+  }
+  stamps[STAMP_core__DerivableCxxObject_O] = 0;
+  if (size_t failed = boehm_check_stamp_layouts(stamps)) {
+    fprintf(stderr,"%s:%d %lu stamps have layouts that don't match their C++ classes and will be marked conservatively\n",
+            __FILE__, __LINE__, (unsigned long)failed);
+  }
+  for ( size_t stamp=0; stamp<=global_stamp_max; ++stamp ) {
+    if ( stamps[stamp]
+         && global_stamp_layout[stamp].container_layout
+         && global_stamp_layout[stamp].container_layout->number_of_fields
+         && !global_stamp_layout[stamp].container_layout->field_layout_start ) {
+      stamps[stamp] = 0;
+    }
+  }
+  global_boehm_precise_kind = GC_new_kind(GC_new_free_list(),
+                                          GC_MAKE_PROC(GC_new_proc(boehm_precise_mark_proc),0),
+                                          0 /* don't add size to descriptor */,
+                                          1 /* clear new objects */);
+  global_boehm_precise_stamps = stamps;
+}
+
+GCPauseHistogram global_gc_pause_histogram;
+bool global_boehm_incremental = false;
+
+void boehm_reset_pause_histogram() {
+  GCPauseHistogram& hist = global_gc_pause_histogram;
+  for ( size_t i=0; i<GC_PAUSE_HISTOGRAM_BUCKETS; ++i ) hist._Buckets[i] = 0;
+  hist._Count = 0;
+  hist._TotalMicroseconds = 0;
+  hist._MaxMicroseconds = 0;
+  hist._Collections = 0;
+}
+
+/*! Time every stop-the-world interval. This runs inside the collector
+    with the allocation lock held so it must not allocate. */
+void boehm_collection_event(GC_EventType event) {
+  GCPauseHistogram& hist = global_gc_pause_histogram;
+  switch (event) {
+  case GC_EVENT_START:
+      ++hist._Collections;
+      break;
+  case GC_EVENT_PRE_STOP_WORLD:
+      clock_gettime(CLOCK_MONOTONIC,&hist._StopStart);
+      break;
+  case GC_EVENT_POST_START_WORLD: {
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC,&now);
+      size_t usec = (now.tv_sec-hist._StopStart.tv_sec)*1000000
+        + (now.tv_nsec-hist._StopStart.tv_nsec)/1000;
+      size_t bucket = 0;
+      while ( bucket < GC_PAUSE_HISTOGRAM_BUCKETS-1 && ((size_t)1<<bucket) <= usec ) ++bucket;
+      ++hist._Buckets[bucket];
+      ++hist._Count;
+      hist._TotalMicroseconds += usec;
+      if ( usec > hist._MaxMicroseconds ) hist._MaxMicroseconds = usec;
+      break;
+  }
+  default:
+      break;
+  }
+}
+
 __attribute__((noinline))
 int initializeBoehm(MainFunctionType startupFn, int argc, char *argv[], bool mpiEnabled, int mpiRank, int mpiSize) {
   GC_set_handle_fork(1);
@@ -257,8 +448,23 @@ int initializeBoehm(MainFunctionType startupFn, int argc, char *argv[], bool mpi
   GC_set_all_interior_pointers(1); // tagged pointers require this
                                    //printf("%s:%d Turning on interior pointers\n",__FILE__,__LINE__);
   GC_set_warn_proc(clasp_warn_proc);
-  //  GC_enable_incremental();
   GC_init();
+  if (getenv("CLASP_BOEHM_PRECISE")) boehm_initialize_precise_marking();
+  // Incremental/generational collection has to be turned on before any
+  // other threads exist. Boehm tracks dirty pages with mprotect (its SIGSEGV
+  // handler chains to the one initialize_signals installed) or soft-dirty bits,
+  // depending on how libgc was configured. Buffers that read() writes into
+  // directly (octet vectors, base-strings) are pointer-free and allocated
+  // atomic so they are never protected.
+  if (getenv("CLASP_BOEHM_INCREMENTAL")) {
+    GC_enable_incremental();
+    global_boehm_incremental = GC_is_incremental_mode();
+    if (char* pause = getenv("CLASP_BOEHM_PAUSE_TARGET_MS")) {
+      GC_set_time_limit(atol(pause));
+    }
+  }
+  boehm_reset_pause_histogram();
+  GC_set_on_collection_event(boehm_collection_event);
   void* topOfStack;
   // ctor sets up my_thread
   gctools::ThreadLocalStateLowLevel thread_local_state_low_level(&topOfStack);
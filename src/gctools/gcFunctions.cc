@@ -20,6 +20,7 @@ int gcFunctions_after;
 #include <unistd.h>
 #include <sstream>
 #include <iomanip>
+#include <tuple>
 
 #include <clasp/core/object.h>
 #include <clasp/core/bformat.h>
@@ -31,6 +32,7 @@ int gcFunctions_after;
 #include <clasp/core/evaluator.h>
 #include <clasp/core/activationFrame.h>
 #include <clasp/core/hashTableEq.h>
+#include <clasp/core/hashTableEqual.h>
 #include <clasp/core/lispStream.h>
 #include <clasp/core/array.h>
 #include <clasp/core/symbolTable.h>
@@ -859,6 +861,318 @@ CL_DEFUN void gctools__garbage_collect() {
   //        printf("Garbage collection done\n");
 };
 
+CL_DOCSTRING("Return T if Boehm marks objects with an exact layout precisely. Set CLASP_BOEHM_PRECISE in the environment to enable it.");
+CL_DEFUN bool gctools__boehm_precise_marking_p() {
+#ifdef USE_BOEHM
+  return global_boehm_precise_stamps != NULL;
+#else
+  return false;
+#endif
+}
+
+CL_DOCSTRING("Return (values heap-size free-bytes) as reported by the collector");
+CL_DEFUN core::T_mv gctools__heap_bytes() {
+#ifdef USE_BOEHM
+  return Values(core::clasp_make_integer(GC_get_heap_size()),core::clasp_make_integer(GC_get_free_bytes()));
+#else
+  return Values(_Nil<core::T_O>(),_Nil<core::T_O>());
+#endif
+}
+
+CL_DOCSTRING("Return T if Boehm is running incremental/generational collections. Set CLASP_BOEHM_INCREMENTAL in the environment to enable it.");
+CL_DEFUN bool gctools__boehm_incremental_p() {
+#ifdef USE_BOEHM
+  return global_boehm_incremental;
+#else
+  return false;
+#endif
+}
+
+CL_LAMBDA(milliseconds);
+CL_DOCSTRING("Set the target pause for an incremental collection step in milliseconds, NIL means no limit");
+CL_DEFUN void gctools__boehm_set_pause_target(core::T_sp milliseconds) {
+#ifdef USE_BOEHM
+  if (milliseconds.nilp()) {
+    GC_set_time_limit(GC_TIME_UNLIMITED);
+  } else {
+    GC_set_time_limit(core::clasp_to_fixnum(milliseconds));
+  }
+#endif
+}
+
+CL_LAMBDA(n);
+CL_DOCSTRING("Set the number of partial collections between full collections in incremental mode");
+CL_DEFUN void gctools__boehm_set_full_collection_frequency(int n) {
+#ifdef USE_BOEHM
+  GC_set_full_freq(n);
+#endif
+}
+
+CL_DOCSTRING("Return the GC pause histogram as a list of (upper-bound-microseconds . count) for the non-empty buckets. Also return (values histogram pauses total-microseconds max-microseconds collections).");
+CL_DEFUN core::T_mv gctools__gc_pause_histogram() {
+#ifdef USE_BOEHM
+  GCPauseHistogram hist = global_gc_pause_histogram;
+  core::List_sp result = _Nil<core::T_O>();
+  for ( int i=GC_PAUSE_HISTOGRAM_BUCKETS-1; i>=0; --i ) {
+    if (hist._Buckets[i]) {
+      result = core::Cons_O::create(core::Cons_O::create(core::clasp_make_integer((size_t)1<<i),
+                                                         core::clasp_make_integer(hist._Buckets[i])),
+                                    result);
+    }
+  }
+  return Values(result,
+                core::clasp_make_integer(hist._Count),
+                core::clasp_make_integer(hist._TotalMicroseconds),
+                core::clasp_make_integer(hist._MaxMicroseconds),
+                core::clasp_make_integer(hist._Collections));
+#else
+  return Values(_Nil<core::T_O>());
+#endif
+}
+
+CL_DEFUN void gctools__gc_pause_histogram_reset() {
+#ifdef USE_BOEHM
+  boehm_reset_pause_histogram();
+#endif
+}
+
+/*! One heap census.  Objects are tallied by header stamp and instances
+    of CLOS classes are also tallied per class.  Classes are keyed by
+    their raw tagged pointer during the walk so that nothing is allocated
+    in the GC heap while the heap is being walked.  The bytes recorded for
+    a class include the instance racks, which only the instance refers to,
+    so they are a cheap estimate of the retained size of the instances. */
+struct HeapCensus {
+  struct Entry {
+    size_t _Count;
+    size_t _Bytes;
+    Entry() : _Count(0), _Bytes(0) {};
+    void update(size_t sz) { ++this->_Count; this->_Bytes += sz; };
+  };
+  std::vector<Entry> _Stamps;
+  std::map<gctools::Tagged, Entry> _Classes;
+  Entry _Headerless;
+  bool _TallyClasses;
+  HeapCensus(bool tallyClasses) : _Stamps(global_NextStamp.load()), _TallyClasses(tallyClasses) {};
+  void note(void* base, size_t sz) {
+    const Header_s* header = reinterpret_cast<const Header_s*>(base);
+    // Conses have no header - anything that doesn't look like a valid stamp lands here
+    if (!header->stampP() || header->stamp() >= this->_Stamps.size()) {
+      this->_Headerless.update(sz);
+      return;
+    }
+    stamp_t stamp = header->stamp();
+    this->_Stamps[stamp].update(sz);
+    if (!this->_TallyClasses) return;
+    void* client = reinterpret_cast<char*>(base) + sizeof(Header_s);
+    if (stamp == STAMP_INSTANCE) {
+      core::Instance_O* instance = reinterpret_cast<core::Instance_O*>(client);
+      this->noteInstance(instance->_Class.tagged_(), instance->_Rack, sz);
+    } else if (stamp == STAMP_FUNCALLABLE_INSTANCE) {
+      core::FuncallableInstance_O* instance = reinterpret_cast<core::FuncallableInstance_O*>(client);
+      this->noteInstance(instance->_Class.tagged_(), instance->_Rack, sz);
+    }
+  }
+  void noteInstance(gctools::Tagged klass, core::SimpleVector_sp rack, size_t sz) {
+    if (rack.generalp()) {
+      sz += sizeof_container_with_header<core::SimpleVector_O>(rack->length());
+    }
+    this->_Classes[klass].update(sz);
+  }
+  /*! Return a list of (key count bytes) sorted by decreasing bytes.
+      Stamps are keyed by their name, classes by the class object. */
+  core::List_sp asList() const {
+    std::vector<std::tuple<core::T_sp, size_t, size_t>> entries;
+    for ( stamp_t stamp=0; stamp<this->_Stamps.size(); ++stamp ) {
+      const Entry& entry = this->_Stamps[stamp];
+      if (entry._Count == 0) continue;
+      const char* name = (stamp <= STAMP_max) ? obj_name(stamp) : NULL;
+      std::string sname = name ? name : (BF("STAMP-%d") % stamp).str();
+      entries.emplace_back(core::SimpleBaseString_O::make(sname), entry._Count, entry._Bytes);
+    }
+    for ( auto it : this->_Classes ) {
+      entries.emplace_back(core::T_sp(it.first), it.second._Count, it.second._Bytes);
+    }
+    if (this->_Headerless._Count) {
+      entries.emplace_back(core::SimpleBaseString_O::make("HEADERLESS"), this->_Headerless._Count, this->_Headerless._Bytes);
+    }
+    sort(entries.begin(), entries.end(), [](const std::tuple<core::T_sp, size_t, size_t>& x, const std::tuple<core::T_sp, size_t, size_t>& y) {
+        return std::get<2>(x) > std::get<2>(y);
+      });
+    core::List_sp result = _Nil<core::T_O>();
+    for ( auto it = entries.rbegin(); it != entries.rend(); ++it ) {
+      result = core::Cons_O::create(core::Cons_O::createList(std::get<0>(*it),
+                                                             core::clasp_make_integer(std::get<1>(*it)),
+                                                             core::clasp_make_integer(std::get<2>(*it))),
+                                    result);
+    }
+    return result;
+  }
+};
+
+#ifdef USE_BOEHM
+void boehm_callback_heap_census(void* ptr, size_t sz, void* client_data) {
+  reinterpret_cast<HeapCensus*>(client_data)->note(ptr,sz);
+}
+#endif
+#ifdef USE_MPS
+void amc_apply_heap_census(mps_addr_t client, void* p, size_t s) {
+  size_t sz = (char*)(obj_skip(client)) - (char*)client;
+  reinterpret_cast<HeapCensus*>(p)->note(ClientPtrToBasePtr(client),sz);
+}
+#endif
+
+CL_LAMBDA(&key (classes t));
+CL_DOCSTRING("Walk the heap and return a census of the live objects as a list of (key count bytes) sorted by decreasing bytes. The key is the stamp name for each kind of object and the class for instances of CLOS classes (only when CLASSES is true). Class bytes include the instance slot vectors. Conses are tallied under HEADERLESS. Also returns (values census total-objects total-bytes). Compare two censuses with HEAP-CENSUS-DIFF. The heap is collected first. No retained size or dominator estimate is computed - that would need a second walk over the pointers of every object, and the census is meant to be cheap enough to take periodically.");
+CL_DEFUN core::T_mv gctools__heap_census(bool classes) {
+  HeapCensus census(classes);
+  core::List_sp result = _Nil<core::T_O>();
+#ifdef USE_BOEHM
+#ifdef BOEHM_GC_ENUMERATE_REACHABLE_OBJECTS_INNER_AVAILABLE
+  // Mark bits are only current right after a collection - without one,
+  // objects made since the last collection would be left out of the census.
+  GC_gcollect();
+  // No collection may run between the walk and resolving the class pointers
+  GC_disable();
+  GC_enumerate_reachable_objects_inner(boehm_callback_heap_census, &census);
+  result = census.asList();
+  GC_enable();
+#else
+  SIMPLE_ERROR(BF("The boehm function GC_enumerate_reachable_objects_inner is not available"));
+#endif
+#endif
+#ifdef USE_MPS
+  // Objects must not move between the walk and resolving the class pointers
+  mps_arena_park(global_arena);
+  mps_amc_apply(global_amc_pool, amc_apply_heap_census, &census, 0);
+  mps_amc_apply(global_amcz_pool, amc_apply_heap_census, &census, 0);
+  result = census.asList();
+  mps_arena_release(global_arena);
+#endif
+  size_t objects = 0;
+  size_t bytes = 0;
+  for ( auto& entry : census._Stamps ) {
+    objects += entry._Count;
+    bytes += entry._Bytes;
+  }
+  objects += census._Headerless._Count;
+  bytes += census._Headerless._Bytes;
+  return Values(result, core::clasp_make_integer(objects), core::clasp_make_integer(bytes));
+}
+
+CL_LAMBDA(old new);
+CL_DOCSTRING("Compare two censuses returned by HEAP-CENSUS and return a list of (key count-delta bytes-delta) for every key that changed, sorted by decreasing bytes-delta.");
+CL_DEFUN core::List_sp gctools__heap_census_diff(core::List_sp old_census, core::List_sp new_census) {
+  core::HashTableEqual_sp old_entries = core::HashTableEqual_O::create_default();
+  for ( auto cur : old_census ) {
+    core::T_sp entry = CONS_CAR(cur);
+    old_entries->hash_table_setf_gethash(oCar(entry), oCdr(entry));
+  }
+  std::vector<std::tuple<core::T_sp, Fixnum, Fixnum>> deltas;
+  for ( auto cur : new_census ) {
+    core::T_sp entry = CONS_CAR(cur);
+    core::T_sp key = oCar(entry);
+    Fixnum count = core::clasp_to_fixnum(oSecond(entry));
+    Fixnum bytes = core::clasp_to_fixnum(oThird(entry));
+    core::T_sp old = old_entries->gethash(key);
+    if (old.notnilp()) {
+      count -= core::clasp_to_fixnum(oCar(old));
+      bytes -= core::clasp_to_fixnum(oSecond(old));
+      old_entries->remhash(key);
+    }
+    if (count || bytes) deltas.emplace_back(key, count, bytes);
+  }
+  // Whatever is left in the old census has disappeared entirely
+  for ( auto cur : old_census ) {
+    core::T_sp entry = CONS_CAR(cur);
+    if (old_entries->gethash(oCar(entry)).notnilp()) {
+      deltas.emplace_back(oCar(entry), -core::clasp_to_fixnum(oSecond(entry)), -core::clasp_to_fixnum(oThird(entry)));
+    }
+  }
+  sort(deltas.begin(), deltas.end(), [](const std::tuple<core::T_sp, Fixnum, Fixnum>& x, const std::tuple<core::T_sp, Fixnum, Fixnum>& y) {
+      return std::get<2>(x) > std::get<2>(y);
+    });
+  core::List_sp result = _Nil<core::T_O>();
+  for ( auto it = deltas.rbegin(); it != deltas.rend(); ++it ) {
+    result = core::Cons_O::create(core::Cons_O::createList(std::get<0>(*it),
+                                                           core::clasp_make_fixnum(std::get<1>(*it)),
+                                                           core::clasp_make_fixnum(std::get<2>(*it))),
+                                  result);
+  }
+  return result;
+}
+
+/*! Collect the instances made obsolete by class redefinition, ie. those
+    whose stamp is not the one their class now gives new instances.  Only
+    the rack and class slots are read during the walk.  Instances still
+    under construction, with no rack or signature yet, are skipped. */
+struct ObsoleteInstanceCollector {
+  std::vector<core::T_sp> _Instances;
+  void note(void* base, size_t sz) {
+    const Header_s* header = reinterpret_cast<const Header_s*>(base);
+    if (!header->stampP() || header->stamp() != STAMP_INSTANCE) return;
+    core::Instance_O* instance = reinterpret_cast<core::Instance_O*>(reinterpret_cast<char*>(base) + sizeof(Header_s));
+    if (!instance->_Rack.generalp() || instance->_Rack->length() == 0) return;
+    if (instance->_Sig.unboundp() || !instance->_Class.generalp()) return;
+    core::Instance_sp klass = instance->_Class;
+    if (!klass->_Rack.generalp()
+        || klass->_Rack->length() <= (core::Instance_O::REF_CLASS_STAMP_FOR_INSTANCES_+RACK_SLOT_START)) return;
+    core::T_sp class_stamp = (*klass->_Rack)[core::Instance_O::REF_CLASS_STAMP_FOR_INSTANCES_+RACK_SLOT_START];
+    core::T_sp instance_stamp = (*instance->_Rack)[0];
+    if (class_stamp.fixnump() && instance_stamp.fixnump() && class_stamp != instance_stamp) {
+      this->_Instances.push_back(instance->asSmartPtr());
+    }
+  }
+  core::List_sp asList() const {
+    core::List_sp result = _Nil<core::T_O>();
+    for ( auto it = this->_Instances.rbegin(); it != this->_Instances.rend(); ++it ) {
+      result = core::Cons_O::create(*it, result);
+    }
+    return result;
+  }
+};
+
+#ifdef USE_BOEHM
+void boehm_callback_obsolete_instances(void* ptr, size_t sz, void* client_data) {
+  reinterpret_cast<ObsoleteInstanceCollector*>(client_data)->note(ptr,sz);
+}
+#endif
+#ifdef USE_MPS
+void amc_apply_obsolete_instances(mps_addr_t client, void* p, size_t s) {
+  size_t sz = (char*)(obj_skip(client)) - (char*)client;
+  reinterpret_cast<ObsoleteInstanceCollector*>(p)->note(ClientPtrToBasePtr(client),sz);
+}
+#endif
+
+CL_LAMBDA();
+CL_DOCSTRING("Walk the heap and return a list of the instances whose class was redefined since they were made, and which are therefore waiting to be updated.");
+CL_DEFUN core::List_sp gctools__obsolete_instances() {
+  ObsoleteInstanceCollector collector;
+  core::List_sp result = _Nil<core::T_O>();
+#ifdef USE_BOEHM
+#ifdef BOEHM_GC_ENUMERATE_REACHABLE_OBJECTS_INNER_AVAILABLE
+  // Mark bits are only current right after a collection - objects made since
+  // the last one would be missed.
+  GC_gcollect();
+  // The collected pointers live outside the GC heap until they are consed up
+  GC_disable();
+  GC_enumerate_reachable_objects_inner(boehm_callback_obsolete_instances, &collector);
+  result = collector.asList();
+  GC_enable();
+#else
+  SIMPLE_ERROR(BF("The boehm function GC_enumerate_reachable_objects_inner is not available"));
+#endif
+#endif
+#ifdef USE_MPS
+  // Objects must not move between the walk and consing up the list
+  mps_arena_park(global_arena);
+  mps_amc_apply(global_amc_pool, amc_apply_obsolete_instances, &collector, 0);
+  result = collector.asList();
+  mps_arena_release(global_arena);
+#endif
+  return result;
+}
+
 CL_DEFUN void gctools__register_stamp_name(const std::string& name,size_t stamp_num)
 {
   register_stamp_name(name,stamp_num);
@@ -20,6 +20,8 @@ SYMBOL_EXPORT_SC_(ExtPkg,illegal_instruction);
 SYMBOL_EXPORT_SC_(ExtPkg,segmentation_violation);
 SYMBOL_EXPORT_SC_(CorePkg,wait_for_all_processes);
 
+std::atomic<uint32_t> clasp_safepoint_word(0);
+
 namespace gctools {
 
 
@@ -180,6 +182,35 @@ void handle_signal_now( core::T_sp signal_code, core::T_sp process ) {
 
 
 
+/*! Arm the safepoint polling words of THREAD.
+    Call with the _SparePendingInterruptRecordsSpinLock held. */
+static void set_safepoint_word(core::ThreadLocalState* thread)
+{
+  if (thread->_LowLevel && thread->_LowLevel->_PendingInterruptsWord.exchange(1)==0) {
+    clasp_safepoint_word.fetch_add(1);
+  }
+}
+
+/*! Disarm the safepoint polling words of THREAD once its queue is empty.
+    Call with the _SparePendingInterruptRecordsSpinLock held. */
+static void clear_safepoint_word(core::ThreadLocalState* thread)
+{
+  if (thread->_LowLevel && thread->_LowLevel->_PendingInterruptsWord.exchange(0)!=0) {
+    clasp_safepoint_word.fetch_sub(1);
+  }
+}
+
+/*! THREAD is exiting and its low level state, which lives on its stack, is
+    about to go away.  Disarm its polling word even if interrupts are still
+    queued, so the global word doesn't stay raised for a thread that will
+    never drain its queue, and forget the low level state so nothing arms it again. */
+void release_safepoint_word(core::ThreadLocalState* thread)
+{
+  mp::SafeSpinLock spinlock(thread->_SparePendingInterruptRecordsSpinLock);
+  clear_safepoint_word(thread);
+  thread->_LowLevel = NULL;
+}
+
 static void queue_signal(core::ThreadLocalState* thread, core::T_sp code, bool allocate)
 {
   if (!code) {
@@ -202,14 +233,18 @@ static void queue_signal(core::ThreadLocalState* thread, core::T_sp code, bool a
     record.unsafe_cons()->_Cdr = _Nil<core::T_O>();
     thread->_PendingInterrupts = clasp_nconc(thread->_PendingInterrupts,record);
 //    core::dbg_lowLevelDescribe(thread->_PendingInterrupts);
+    set_safepoint_word(thread);
   }
 }
 
 core::T_sp pop_signal(core::ThreadLocalState* thread) {
   core::T_sp record, value;
-  if (!thread->_PendingInterrupts.consp()) return _Nil<core::T_O>();
   { // <---- brace for spinlock scope
     mp::SafeSpinLock spinlock(thread->_SparePendingInterruptRecordsSpinLock);
+    if (!thread->_PendingInterrupts.consp()) {
+      clear_safepoint_word(thread);
+      return _Nil<core::T_O>();
+    }
     record = thread->_PendingInterrupts;
     value = record.unsafe_cons()->_Car;
     thread->_PendingInterrupts = record.unsafe_cons()->_Cdr;
@@ -222,12 +257,15 @@ core::T_sp pop_signal(core::ThreadLocalState* thread) {
   }
   return value;
 }
-void handle_all_queued_interrupts()
+/*! Called from a safepoint when the polling word is set.
+    The polling word stays set until the queue has been drained so an
+    interrupt queued while a handler runs is picked up by this loop. */
+void handle_all_queued_interrupts_slow()
 {
-  while (my_thread->_PendingInterrupts.consp()) {
-    printf("%s:%d:%s Handling a signal - there are pending interrupts\n", __FILE__, __LINE__, __FUNCTION__ );
+  if (my_thread_low_level->_DisableInterrupts) return;
+  while (1) {
     core::T_sp sig = pop_signal(my_thread);
-    printf("%s:%d:%s Handling a signal: %s\n", __FILE__, __LINE__, __FUNCTION__, _rep_(sig).c_str() );
+    if (sig.nilp()) break;
     handle_signal_now(sig, my_thread->_Process);
   }
 }
@@ -69,18 +69,7 @@ void DynamicBindingStack::release_binding_index(size_t index)
 
 T_sp* DynamicBindingStack::reference_raw_(Symbol_O* var,T_sp* globalValuePtr) {
 #ifdef CLASP_THREADS
-  if ( var->_BindingIdx.load() == NO_THREAD_LOCAL_BINDINGS ) {
-    return globalValuePtr;
-  }
-  uintptr_clasp_t index = var->_BindingIdx.load();
-  // If it has a _Binding value but our table is not big enough, then expand the table.
-  unlikely_if (index >= this->_ThreadLocalBindings.size()) {
-    this->_ThreadLocalBindings.resize(index+1,_NoThreadLocalBinding<T_O>());
-  }
-  if (gctools::tagged_no_thread_local_bindingp(this->_ThreadLocalBindings[index].raw_())) {
-    return globalValuePtr;
-  }
-  return &this->_ThreadLocalBindings[index];
+  return this->reference_index(var->_BindingIdx.load(std::memory_order_relaxed),globalValuePtr);
 #else
   return globalValuePtr;
 #endif
@@ -88,23 +77,20 @@ T_sp* DynamicBindingStack::reference_raw_(Symbol_O* var,T_sp* globalValuePtr) {
 
 const T_sp* DynamicBindingStack::reference_raw_(const Symbol_O* var,const T_sp* globalValuePtr) const{
 #ifdef CLASP_THREADS
-  if ( var->_BindingIdx.load() == NO_THREAD_LOCAL_BINDINGS ) {
-    return globalValuePtr;
-  }
-  uintptr_clasp_t index = var->_BindingIdx.load();
-  // If it has a _Binding value but our table is not big enough, then expand the table.
-  unlikely_if (index >= this->_ThreadLocalBindings.size()) {
-    this->_ThreadLocalBindings.resize(index+1,_NoThreadLocalBinding<T_O>());
-  }
-  if (gctools::tagged_no_thread_local_bindingp(this->_ThreadLocalBindings[index].raw_())) {
-    return globalValuePtr;
-  }
-  return &this->_ThreadLocalBindings[index];
+  return this->reference_index(var->_BindingIdx.load(std::memory_order_relaxed),const_cast<T_sp*>(globalValuePtr));
 #else
   return globalValuePtr;
 #endif
 }
 
+/*! Grow the thread local binding table so that index is valid.
+    Grow geometrically so that threads that bind many new specials
+    don't resize the table on every new binding. */
+void DynamicBindingStack::expandThreadLocalBindings(size_t index) {
+  size_t size = std::max(index+1,this->_ThreadLocalBindings.size()*2);
+  this->_ThreadLocalBindings.resize(size,_NoThreadLocalBinding<T_O>());
+}
+
 SYMBOL_EXPORT_SC_(CorePkg,STARwatchDynamicBindingStackSTAR);
 void DynamicBindingStack::push_with_value_coming(Symbol_sp var, T_sp* globalValuePtr) {
   T_sp* current_value_ptr = this->reference(var,globalValuePtr);
@@ -124,7 +110,7 @@ void DynamicBindingStack::push_with_value_coming(Symbol_sp var, T_sp* globalValu
   uintptr_clasp_t index = var->_BindingIdx.load();
   // If it has a _Binding value but our table is not big enough, then expand the table.
   unlikely_if (index >= this->_ThreadLocalBindings.size()) {
-    this->_ThreadLocalBindings.resize(index+1,_NoThreadLocalBinding<T_O>());
+    this->expandThreadLocalBindings(index);
   }
 #ifdef DEBUG_DYNAMIC_BINDING_STACK // debugging
   if (  _sym_STARwatchDynamicBindingStackSTAR &&
@@ -158,7 +144,7 @@ void DynamicBindingStack::push_binding(Symbol_sp var, T_sp* globalValuePtr, T_sp
   uintptr_clasp_t index = var->_BindingIdx.load();
   // If it has a _Binding value but our table is not big enough, then expand the table.
   unlikely_if (index >= this->_ThreadLocalBindings.size()) {
-    this->_ThreadLocalBindings.resize(index+1,_NoThreadLocalBinding<T_O>());
+    this->expandThreadLocalBindings(index);
   }
 #ifdef DEBUG_DYNAMIC_BINDING_STACK // debugging
   if (  _sym_STARwatchDynamicBindingStackSTAR &&
@@ -203,7 +189,13 @@ namespace gctools {
 ThreadLocalStateLowLevel::ThreadLocalStateLowLevel(void* stack_top) :
   _DisableInterrupts(false)
   ,  _StackTop(stack_top)
-{};
+  ,  _PendingInterruptsWord(0)
+  ,  _ConsFreeList(NULL)
+{
+#ifdef USE_BOEHM
+  for ( size_t i=0; i<BOEHM_PRECISE_FREE_LISTS; ++i ) this->_BoehmPreciseFreeLists[i] = NULL;
+#endif
+};
 
 ThreadLocalStateLowLevel::~ThreadLocalStateLowLevel()
 {};
@@ -227,6 +219,7 @@ _PendingInterrupts(_Nil<core::T_O>())
   this->_Tid = 0;
 #endif
   this->_InvocationHistoryStackTop = NULL;
+  this->_LowLevel = NULL;
   this->_BufferStr8NsPool.reset_(); // Can't use _Nil<core::T_O>(); - too early
   this->_BufferStrWNsPool.reset_();
 }
@@ -246,6 +239,13 @@ void ThreadLocalState::initialize_thread(mp::Process_sp process, bool initialize
   }
 //  printf("%s:%d Initialize all ThreadLocalState things this->%p\n",__FILE__, __LINE__, (void*)this);
   this->_Bindings.reserve(1024);
+#ifdef CLASP_THREADS
+  // Size the thread local binding table for every binding index handed out so far
+  // so that binding existing specials in this thread doesn't grow the table.
+  this->_Bindings._ThreadLocalBindings.resize(std::max((size_t)INITIAL_THREAD_LOCAL_BINDINGS,mp::global_LastBindingIndex.load()),
+                                              _NoThreadLocalBinding<T_O>());
+#endif
+  this->_LowLevel = my_thread_low_level;
   this->_Process = process;
   process->_ThreadInfo = this;
   this->_BFormatStringOutputStream = gc::As<StringOutputStream_sp>(clasp_make_string_output_stream());
@@ -186,6 +186,24 @@ when this is t a lot of graphs will be generated.")
           (core:*current-source-pos-info*)
           (t (core:make-source-pos-info "no-source-info-available" 0 0 0)))))
 
+;;; Return a hash table of the BLOCKS (in layout order) that are the target
+;;; of a branch from themselves or a later block.  Every loop has such an
+;;; edge, so polling for interrupts at the start of these blocks polls once
+;;; per iteration of every loop, like bclasp does at TAGBODY tags.
+(defun loop-head-blocks (blocks)
+  (let ((positions (make-hash-table :test #'eq))
+        (heads (make-hash-table :test #'eq)))
+    (loop for block in blocks
+          for position from 0
+          do (setf (gethash block positions) position))
+    (loop for block in blocks
+          for position from 0
+          do (loop for successor in (cleavir-basic-blocks:successors block)
+                   for successor-position = (gethash successor positions)
+                   when (and successor-position (<= successor-position position))
+                     do (setf (gethash successor heads) t)))
+    heads))
+
 (defun layout-procedure* (the-function body-irbuilder
                                        body-block
                                        first-basic-block
@@ -206,11 +224,15 @@ when this is t a lot of graphs will be generated.")
        (cmp:irc-set-insert-point-basic-block body-block body-irbuilder)
        (with-catch-pad-prep
         (cmp:irc-begin-block body-block)
+        (cmp:irc-safepoint)
         (layout-basic-block first-basic-block return-value abi function-info)
-        (loop for block in rest-basic-blocks
-              for instruction = (cleavir-basic-blocks:first-instruction block)
-              do (cmp:irc-begin-block (gethash instruction *tags*))
-              (layout-basic-block block return-value abi function-info)))
+        (let ((loop-heads (loop-head-blocks (cons first-basic-block rest-basic-blocks))))
+          (loop for block in rest-basic-blocks
+                for instruction = (cleavir-basic-blocks:first-instruction block)
+                do (cmp:irc-begin-block (gethash instruction *tags*))
+                   (when (gethash block loop-heads)
+                     (cmp:irc-safepoint))
+                   (layout-basic-block block return-value abi function-info))))
        ;; finish up by jumping from the entry block to the body block
        (cmp:with-irbuilder (cmp:*irbuilder-function-alloca*)
                            (cmp:irc-br body-block))
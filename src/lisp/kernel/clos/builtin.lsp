@@ -89,5 +89,28 @@
          (copy (allocate-instance class))
          (size (class-size class)))
     (loop for i below size
-          do (si:instance-set copy i (si:instance-ref structure i)))
+          for slotd in (class-slots class)
+          for value = (si:instance-ref structure i)
+          ;; The storage of unboxed slots (see defstruct.lsp) is not shared.
+          do (si:instance-set copy i (if (si::raw-slot-storage-name-p (slot-definition-name slotd))
+                                         (copy-seq value)
+                                         value)))
     copy))
+
+;;; Unboxed structure slots are not slots of the class, so SLOT-VALUE and
+;;; friends end up here.  They are still accessible by name.
+(defmethod slot-missing ((class structure-class) object slot-name operation
+                         &optional new-value)
+  (let* ((name (class-name class))
+         (raw (and name (assoc slot-name (si::structure-raw-layout name)))))
+    (if raw
+        (destructuring-bind (storage offset element-type) (rest raw)
+          (declare (ignore element-type))
+          (let ((vector (si:instance-ref object (position storage (si::structure-rack-slots name)))))
+            (ecase operation
+              (slot-value (aref vector offset))
+              (setf (setf (aref vector offset) new-value))
+              (slot-boundp t)
+              (slot-makunbound (error "The unboxed slot ~A of ~A cannot be made unbound."
+                                      slot-name object)))))
+        (call-next-method))))
@@ -102,55 +102,165 @@
 ;;;	   with enough information to perform any extra initialization,
 ;;;	   for instance of new slots.
 ;;;
-;;; UPDATE-INSTANCE is invoked whenever a generic function dispatch misses.
+;;; UPDATE-INSTANCE is invoked whenever a generic function dispatch misses,
+;;; and whenever SLOT-VALUE and friends are handed an obsolete instance.
+;;; MIGRATE-OBSOLETE-INSTANCES updates every obsolete instance in the heap
+;;; at once, optionally in a background thread.
 ;;;
 
 (defmethod update-instance-for-redefined-class
     ((instance standard-object) added-slots discarded-slots property-list
      &rest initargs)
   (declare (dynamic-extent initargs))
-  (check-initargs (class-of instance) initargs
-		  (valid-keywords-from-methods
-                   (compute-applicable-methods
-                    #'update-instance-for-redefined-class
-                    (list instance added-slots discarded-slots property-list))
-                   (compute-applicable-methods
-                    #'shared-initialize
-                    (list instance added-slots))))
+  ;; UPDATE-INSTANCE passes no initargs, and those need no checking.
+  (when initargs
+    (check-initargs (class-of instance) initargs
+                    (valid-keywords-from-methods
+                     (compute-applicable-methods
+                      #'update-instance-for-redefined-class
+                      (list instance added-slots discarded-slots property-list))
+                     (compute-applicable-methods
+                      #'shared-initialize
+                      (list instance added-slots)))))
   (apply #'shared-initialize instance added-slots initargs))
 
+;;; All the obsolete instances with the same stamp share their old list of
+;;; slots, so how their slots move to the new layout is worked out once and
+;;; kept in a migration plan for that stamp.  MOVES has an entry for each
+;;; new local slot: the old index of its value, or NIL if the slot was
+;;; added.  DISCARDED is an alist of (name . old-index).  A plan is only
+;;; used while the old slots and the new stamp it was made for still
+;;; match, so a redefined class simply gets new plans.
+
+(defstruct (migration-plan (:type vector))
+  old-slotds new-stamp size moves added-slots discarded)
+
+(defvar *migration-plans* (make-hash-table :test #'eql :thread-safe t))
+
+;;; Obsolete instances are updated while holding this lock, and the stamp
+;;; is checked again once it is held, so an instance touched by one thread
+;;; while MIGRATE-OBSOLETE-INSTANCES walks the heap in another is only
+;;; updated once.  It is recursive because methods on
+;;; UPDATE-INSTANCE-FOR-REDEFINED-CLASS may touch other obsolete instances.
+#+threads
+(defparameter *migration-lock* (mp:make-lock :name 'migrate-obsolete-instances :recursive t))
+
+;;; Numbers of instances updated on first touch and by heap walks.
+(defvar *lazy-migrations* (ext:make-atomic 0))
+(defvar *walk-migrations* (ext:make-atomic 0))
+
+(defun count-migration (counter)
+  (loop for old = (ext:atomic-get counter)
+        until (ext:atomic-compare-and-swap-weak counter old (1+ old))))
+
+(defun obsolete-instance-p (instance)
+  (not (eql (core:instance-stamp instance)
+            (core:class-stamp-for-instances (class-of instance)))))
+
+(defun compute-migration-plan (old-slotds class)
+  (let* ((new-slotds (class-slots class))
+         (old-names (mapcar #'slot-definition-name
+                            (remove :instance old-slotds :test-not #'eq
+                                    :key #'slot-definition-allocation)))
+         (new-names (mapcar #'slot-definition-name
+                            (remove :instance new-slotds :test-not #'eq
+                                    :key #'slot-definition-allocation)))
+         (moves (make-array (length new-names))))
+    (loop for name in new-names
+          for new-i from 0
+          do (setf (svref moves new-i) (position name old-names)))
+    (make-migration-plan
+     :old-slotds old-slotds
+     :new-stamp (core:class-stamp-for-instances class)
+     :size (class-size class)
+     :moves moves
+     :added-slots (loop for name in new-names
+                        unless (member name old-names) collect name)
+     :discarded (loop for name in old-names
+                      for old-i from 0
+                      unless (member name new-names) collect (cons name old-i)))))
+
+(defun find-migration-plan (instance class)
+  (let* ((stamp (core:instance-stamp instance))
+         (old-slotds (si:instance-sig instance))
+         (plan (gethash stamp *migration-plans*)))
+    (if (and plan
+             (eq (migration-plan-old-slotds plan) old-slotds)
+             (eql (migration-plan-new-stamp plan) (core:class-stamp-for-instances class)))
+        plan
+        (setf (gethash stamp *migration-plans*)
+              (compute-migration-plan old-slotds class)))))
+
 (defun update-instance (instance)
   (let* ((class (class-of instance))
-	 (old-slotds (si:instance-sig instance))
-	 (new-slotds (class-slots class))
-	 (old-instance (si::copy-instance instance))
-	 (discarded-slots '())
-	 (added-slots '())
-	 (property-list '()))
-    (setf instance (core:reallocate-instance instance class (class-size class)))
-    (let* ((new-i 0)
-           (old-local-slotds (remove :instance old-slotds :test-not #'eq
-                                     :key #'slot-definition-allocation))
-           (new-local-slotds (remove :instance new-slotds :test-not #'eq
-                                     :key #'slot-definition-allocation)))
-      (declare (fixnum new-i))
-      (setq discarded-slots
-            (set-difference (mapcar #'slot-definition-name old-local-slotds)
-                            (mapcar #'slot-definition-name new-local-slotds)))
-      (dolist (slot-name discarded-slots)
-        (let* ((ndx (position slot-name old-local-slotds :key #'slot-definition-name)))
-          (push (cons slot-name (si::instance-ref old-instance ndx))
-                property-list)))
-      (dolist (new-slot new-local-slotds)
-        (let* ((name (slot-definition-name new-slot))
-               (old-i (position name old-local-slotds :key #'slot-definition-name)))
-          (if old-i
-              (si::instance-set instance new-i
-                                (si::instance-ref old-instance old-i))
-              (push name added-slots))
-          (incf new-i))))
-    (update-instance-for-redefined-class instance added-slots
-                                         discarded-slots property-list)))
+         (plan (find-migration-plan instance class))
+         (old-instance (si::copy-instance instance))
+         (property-list '()))
+    ;; This also gives the instance the new stamp, so methods on
+    ;; UPDATE-INSTANCE-FOR-REDEFINED-CLASS see an up to date instance.
+    (setf instance (core:reallocate-instance instance class (migration-plan-size plan)))
+    (let ((moves (migration-plan-moves plan)))
+      (dotimes (new-i (length moves))
+        (let ((old-i (svref moves new-i)))
+          (when old-i
+            (si::instance-set instance new-i (si::instance-ref old-instance old-i))))))
+    (loop for (name . old-i) in (migration-plan-discarded plan)
+          for value = (si::instance-ref old-instance old-i)
+          when (si:sl-boundp value)
+            do (push (cons name value) property-list))
+    (update-instance-for-redefined-class instance (migration-plan-added-slots plan)
+                                         (mapcar #'car (migration-plan-discarded plan))
+                                         property-list)))
+
+(defun update-obsolete-instance (instance)
+  (mp:with-lock (*migration-lock*)
+    ;; Another thread may have updated it since the caller checked.
+    (when (obsolete-instance-p instance)
+      (update-instance instance)
+      (count-migration *lazy-migrations*)))
+  instance)
+
+(defun migrate-obsolete-instances (&key background)
+  "Update every obsolete instance in the heap now rather than on first touch.
+Returns the number of instances updated, or with BACKGROUND true, the thread
+doing the updating."
+  (flet ((migrate ()
+           (let ((count 0)
+                 (stamps '())
+                 (planned (let ((keys '()))
+                            (maphash (lambda (stamp plan)
+                                       (declare (ignore plan))
+                                       (push stamp keys))
+                                     *migration-plans*)
+                            keys)))
+             (dolist (instance (gctools:obsolete-instances))
+               (mp:with-lock (*migration-lock*)
+                 ;; It may have been touched since the walk.
+                 (when (obsolete-instance-p instance)
+                   (pushnew (core:instance-stamp instance) stamps)
+                   (update-instance instance)
+                   (count-migration *walk-migrations*)
+                   (incf count))))
+             ;; No instance is left with the stamps the walk updated, nor
+             ;; with the stamps of plans that existed before it but that it
+             ;; didn't find, and no new instance gets an old stamp.
+             (mp:with-lock (*migration-lock*)
+               (dolist (stamp (append stamps planned))
+                 (remhash stamp *migration-plans*)))
+             count)))
+    (if background
+        (mp:process-run-function 'migrate-obsolete-instances #'migrate)
+        (migrate))))
+
+(defun instance-migration-counts ()
+  "Return the numbers of obsolete instances updated on first touch and by
+MIGRATE-OBSOLETE-INSTANCES, and the number of migration plans."
+  (values (ext:atomic-get *lazy-migrations*)
+          (ext:atomic-get *walk-migrations*)
+          (hash-table-count *migration-plans*)))
+
+;;; SLOT-VALUE and friends can now update obsolete instances.
+(setf *update-obsolete-instances* t)
 
 ;;; ----------------------------------------------------------------------
 ;;; CLASS REDEFINITION PROTOCOL
@@ -217,14 +327,23 @@
          ;; Of course there have to BE old slots - with e.g. forward references
          ;; this may not be so.
          (old-slots-p (slot-boundp class 'slots))
-         (old-slots (when old-slots-p (class-slots class))))
+         (old-slots (when old-slots-p (class-slots class)))
+         ;; Subclasses are finalized again along with the class, which
+         ;; can move their slots too.
+         (old-subclass-slots (loop for subclass in (remove class (subclasses* class))
+                                   when (slot-boundp subclass 'slots)
+                                     collect (cons subclass (class-slots subclass)))))
     (setf (class-finalized-p class) nil)
     (finalize-unless-forward class)
 
     (unless (and old-slots-p
                  (slot-boundp class 'slots) ; new-slots-p
                  (slots-unchanged-p old-slots (class-slots class)))
-      (make-instances-obsolete class)))
+      (make-instances-obsolete class))
+    (loop for (subclass . old-slots) in old-subclass-slots
+          unless (and (slot-boundp subclass 'slots)
+                      (slots-unchanged-p old-slots (class-slots subclass)))
+            do (make-instances-obsolete subclass)))
 
   (update-dependents class initargs))
 
@@ -258,7 +258,7 @@
                 (gf-log "(core:instance-stamp i) -> %s%N" (core:instance-stamp i))
                 (gf-log "(core:class-stamp-for-instances (core:instance-class i)) -> %s%N" (core:class-stamp-for-instances (core:instance-class i)))
                 (setf invalid-instance t)
-                (clos::update-instance i)
+                (clos::update-obsolete-instance i)
                 (core:instance-stamp-set i (core:class-stamp-for-instances (si:instance-class i)))))))))
     invalid-instance))
 
@@ -261,6 +261,7 @@
 (defun add-method (gf method)
   ;; during boot it's a structure accessor
   (declare (notinline method-qualifiers remove-method))
+  (incf *constructor-epoch*)
   ;;
   ;; 1) The method must not be already installed in another generic function.
   ;;
@@ -322,6 +323,7 @@ and cannot be added to ~A." method other-gf gf)))
   gf)
 
 (defun remove-method (gf method)
+  (incf *constructor-epoch*)
   (setf (generic-function-methods gf)
 	(delete method (generic-function-methods gf))
 	(method-generic-function method) nil)
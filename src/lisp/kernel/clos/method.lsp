@@ -359,8 +359,14 @@ have disappeared."
 (defun method-p (x)
   (si::instancep x))
 
+;;; Bumped whenever a method is added or removed or a class is finalized
+;;; or made obsolete, which invalidates the MAKE-INSTANCE constructors
+;;; (see CONSTRUCTORS in standard.lsp).
+(defvar *constructor-epoch* 0)
+
 ;;; early version used during bootstrap
 (defun add-method (gf method)
+  (incf *constructor-epoch*)
   (with-early-accessors (+standard-method-slots+ +standard-generic-function-slots+ +standard-class-slots+)
     (let* ((name (slot-value gf 'name))
 	   (method-entry (assoc name *early-methods*)))
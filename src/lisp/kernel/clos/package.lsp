@@ -154,6 +154,8 @@
 (export '(invalidate-generic-functions-with-class-selector
           satiate
           satiate-initialization
+          migrate-obsolete-instances
+          instance-migration-counts
           ))
 
 (export '*environment-contains-closure-hook*)
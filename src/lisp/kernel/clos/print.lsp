@@ -200,26 +200,36 @@ printer and we should rather use MAKE-LOAD-FORM."
       (return-from print-object obj))
     (write-string "#S(" stream)
     (prin1 (class-name class) stream)
-    (do ((scan slotds (cdr scan))
-	 (i 0 (1+ i))
-	 (limit (or *print-length* most-positive-fixnum))
-	 (sv))
-	((null scan))
-      (declare (fixnum i))
-      (when (>= i limit)
-	(write-string " ..." stream)
-	(return))
-      (setq sv (si:instance-ref obj i))
-      ;; fix bug where symbols like :FOO::BAR are printed
-      (write-string " " stream)
-      (let ((kw (intern (symbol-name (slot-definition-name (car scan)))
-                        (load-time-value (find-package "KEYWORD")))))
-        (prin1 kw stream))
-      (write-string " " stream)
-      (if *print-level*
-          (let ((*print-level* (1- *print-level*)))
-            (prin1 sv stream))
-          (prin1 sv stream)))
+    ;; Unboxed slots (see defstruct.lsp) are printed from their storage
+    ;; after the boxed ones, and the storage slots are not printed.
+    (let ((raw-layout (si::structure-raw-layout (class-name class)))
+          (count 0)
+          (limit (or *print-length* most-positive-fixnum)))
+      (declare (fixnum count))
+      (flet ((print-slot (name sv)
+               (when (>= count limit)
+                 (write-string " ...)" stream)
+                 (return-from print-object obj))
+               (incf count)
+               ;; fix bug where symbols like :FOO::BAR are printed
+               (write-string " " stream)
+               (let ((kw (intern (symbol-name name)
+                                 (load-time-value (find-package "KEYWORD")))))
+                 (prin1 kw stream))
+               (write-string " " stream)
+               (if *print-level*
+                   (let ((*print-level* (1- *print-level*)))
+                     (prin1 sv stream))
+                   (prin1 sv stream))))
+        (do ((scan slotds (cdr scan))
+             (i 0 (1+ i)))
+            ((null scan))
+          (declare (fixnum i))
+          (let ((name (slot-definition-name (car scan))))
+            (unless (and raw-layout (si::raw-slot-storage-name-p name))
+              (print-slot name (si:instance-ref obj i)))))
+        (dolist (raw raw-layout)
+          (print-slot (first raw) (slot-value obj (first raw))))))
     (write-string ")" stream)
     obj))
 
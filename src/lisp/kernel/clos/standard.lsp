@@ -151,6 +151,129 @@
     (apply #'initialize-instance instance initargs)
     instance))
 
+;;; ----------------------------------------------------------------------
+;;; CONSTRUCTORS
+;;;
+;;; (MAKE-INSTANCE 'NAME :KEY1 V1 ...) with a constant class name and
+;;; constant keywords is compiled (see cmp/opt-object.lsp) into a call of
+;;; the function in a constructor cell (FUNCTION CLASS-NAME . KEYS) with
+;;; the cell and the values V1 ...  The function is made on the first call
+;;; and made again whenever the class named NAME changes or
+;;; *CONSTRUCTOR-EPOCH* is bumped by a method being added or removed or a
+;;; class being finalized or made obsolete.
+;;;
+;;; When only the standard MAKE-INSTANCE, ALLOCATE-INSTANCE,
+;;; INITIALIZE-INSTANCE and SHARED-INITIALIZE methods apply, the constructor
+;;; allocates the instance and stores the values, default initargs and
+;;; initforms straight into the slots.  When only INITIALIZE-INSTANCE or
+;;; SHARED-INITIALIZE have other methods it skips the initarg checks and
+;;; dispatch of MAKE-INSTANCE.  Anything else calls MAKE-INSTANCE.
+
+(defun make-constructor-cell (class-name keys)
+  (let ((cell (list* nil class-name keys)))
+    (setf (car cell)
+          (lambda (cell &rest values)
+            (apply (install-constructor cell) cell values)))
+    cell))
+
+(defun constructor-initargs (keys values)
+  (loop for key in keys
+        for value in values
+        nconc (list key value)))
+
+(defun constructor-initargs-valid-p (class keys)
+  (let ((keywords (if (slot-boundp class 'valid-initargs)
+                      (class-valid-initargs class)
+                      (precompute-valid-initarg-keywords class)))
+        (slots (class-slots class)))
+    (and (not (member :allow-other-keys keys))
+         (or (eq keywords t)
+             (every (lambda (key)
+                      (or (member key slots :test #'member :key #'slot-definition-initargs)
+                          (member key keywords)))
+                    (append keys (mapcar #'first (class-default-initargs class))))))))
+
+(defun only-standard-method-p (gf classes specializers)
+  "True if the only method of GF applicable to CLASSES is the primary one on SPECIALIZERS."
+  (multiple-value-bind (methods ok)
+      (std-compute-applicable-methods-using-classes gf classes)
+    (and ok methods (null (rest methods))
+         (null (method-qualifiers (first methods)))
+         (equal (method-specializers (first methods)) specializers))))
+
+(defun standard-slot-filling-constructor (class keys)
+  ;; Evaluate the default initargs first, like ADD-DEFAULT-INITARGS, then
+  ;; fill each slot from the leftmost initarg that names it or its initform,
+  ;; in the order SHARED-INITIALIZE does.
+  (let* ((defaults (remove-if (lambda (default) (member (first default) keys))
+                              (class-default-initargs class)))
+         (default-functions (mapcar #'third defaults))
+         (initargs (append keys (mapcar #'first defaults)))
+         (size (class-size class))
+         (plan (loop for slotd in (class-slots class)
+                     for position = (position-if (lambda (initarg)
+                                                   (member initarg (slot-definition-initargs slotd)))
+                                                 initargs)
+                     for initfunction = (slot-definition-initfunction slotd)
+                     when (or position initfunction)
+                       collect (cons (slot-definition-location slotd)
+                                     (or position initfunction)))))
+    (lambda (values)
+      (let ((instance (core:allocate-new-instance class size))
+            (values (if default-functions
+                        (append values (mapcar #'funcall default-functions))
+                        values)))
+        (dolist (action plan instance)
+          (let ((source (cdr action)))
+            (si:instance-set instance (car action)
+                             (if (functionp source)
+                                 (funcall source)
+                                 (nth source values)))))))))
+
+(defun initializing-constructor (class keys)
+  (let ((size (class-size class)))
+    (lambda (values)
+      (let ((initargs (add-default-initargs class (constructor-initargs keys values)))
+            (instance (core:allocate-new-instance class size)))
+        (apply #'initialize-instance instance initargs)
+        instance))))
+
+(defun compute-constructor (class keys)
+  (let ((metaclass (class-of class))
+        (t-class (find-class t)))
+    (when (and (eq metaclass (find-class 'standard-class))
+               (constructor-initargs-valid-p class keys)
+               (only-standard-method-p #'make-instance (list metaclass) (list (find-class 'class)))
+               (only-standard-method-p #'allocate-instance (list metaclass) (list metaclass)))
+      (if (and (only-standard-method-p #'initialize-instance (list class) (list t-class))
+               (only-standard-method-p #'shared-initialize (list class (find-class 'symbol))
+                                       (list t-class t-class))
+               (every (lambda (slotd) (eq (slot-definition-allocation slotd) :instance))
+                      (class-slots class)))
+          (standard-slot-filling-constructor class keys)
+          (initializing-constructor class keys)))))
+
+(defun install-constructor (cell)
+  (destructuring-bind (class-name . keys) (cdr cell)
+    (let ((holder (core:find-class-holder class-name))
+          (class (find-class class-name nil)))
+      (when (and class (not (class-finalized-p class)))
+        (finalize-unless-forward class))
+      (let ((epoch *constructor-epoch*)
+            (constructor (or (and class (class-finalized-p class)
+                                  (compute-constructor class keys))
+                             (lambda (values)
+                               (apply #'make-instance class-name (constructor-initargs keys values))))))
+        (setf (car cell)
+              (lambda (cell &rest values)
+                (declare (dynamic-extent values))
+                (if (and (eql epoch *constructor-epoch*)
+                         (if (ext:class-unboundp holder)
+                             (null class)
+                             (eq (ext:class-get holder) class)))
+                    (funcall constructor values)
+                    (apply (install-constructor cell) cell values))))))))
+
 (defun delete-keyword (keyword list)
   (loop until (eq (getf list keyword list) list)
      do (remf list keyword))
@@ -204,6 +327,7 @@
   ;; instances will have a different stamp from their class, which is how the system
   ;; determines obsolesence (in MAYBE-UPDATE-INSTANCES).
   (core:class-new-stamp class)
+  (incf *constructor-epoch*)
   ;; Now this removes the class from all generic function fast paths. This ensures that
   ;; if a generic function is specialized where an obsolete instance is, it will go to
   ;; the slow path, which will call MAYBE-UPDATE-INSTANCES.
@@ -343,6 +467,7 @@ because it contains a reference to the undefined class~%  ~A"
 	(return-from finalize-inheritance
 	  (finalize-inheritance x))))
     (setf (class-precedence-list class) cpl)
+    (incf *constructor-epoch*)
     (let ((slots (compute-slots class)))
       (setf (class-slots class) slots
 	    (class-size class) (compute-instance-size slots)
@@ -121,6 +121,12 @@
      (with-early-accessors (,slots)
        ,@body)))
 
+;;;
+;;; Bumped whenever a class gets new slot locations, so that the slot
+;;; caches below notice layout changes of classes that keep their stamp.
+;;;
+(defvar *slot-location-epoch* 0)
+
 ;;;
 ;;; ECL classes store slots in a hash table for faster access. The
 ;;; following functions create the cache and allow us to locate the
@@ -145,7 +151,8 @@
 	    (setf (gethash (slot-definition-name slotd) locations)
 		  (slot-definition-location slotd))))
 	(setf slot-table table
-	      location-table locations)))))
+	      location-table locations)
+        (incf *slot-location-epoch*)))))
 
 (defun find-slot-definition (class slot-name)
   (with-slots ((slots slots) (slot-table slot-table))
@@ -195,13 +202,71 @@
          (invalid-slot-location instance location)))
   val)
 
+;;;
+;;; An obsolete instance still has the layout of its class before the
+;;; class was redefined, so it is updated before its slots are looked up.
+;;; UPDATE-OBSOLETE-INSTANCE is in change.lsp, which turns this on.
+;;;
+
+(defvar *update-obsolete-instances* nil)
+
+(defmacro ensure-up-to-date-instance (instance class)
+  `(when (and (not (eql (core:instance-stamp ,instance)
+                        (core:class-stamp-for-instances ,class)))
+              *update-obsolete-instances*
+              (si:sl-boundp (si:instance-sig ,instance)))
+     (update-obsolete-instance ,instance)))
+
+;;;
+;;; SLOT CACHES
+;;;
+;;; SLOT-VALUE and (SETF SLOT-VALUE) with a constant slot name compile
+;;; into an inline check against a cache at the call site (see
+;;; cmp/opt-object.lsp).  The cache is a cons (entry . slot-name), where
+;;; an entry is #(stamp epoch location).  The call site makes the cache at
+;;; load time with the entry #(nil nil nil), which never matches, and
+;;; without calling anything from this file, since CLOS files that are
+;;; loaded before it get the same expansion when CLOS is rebuilt.  On a
+;;; hit, that is when the instance stamp and *SLOT-LOCATION-EPOCH* match
+;;; the entry, the slot is read or written straight from the rack.
+;;; Entries are only made for local slots of classes with a location
+;;; table, where SLOT-VALUE itself would do exactly that.  A new entry
+;;; replaces the old one as a whole, so another thread never sees a
+;;; stamp paired with the wrong location.
+;;;
+
+(defun fill-slot-cache (cache instance)
+  (with-early-accessors (+standard-class-slots+)
+    (let* ((stamp (core:instance-stamp instance))
+           (epoch *slot-location-epoch*)
+           (class (class-of instance))
+           (location-table (class-location-table class)))
+      ;; Obsolete instances keep their old stamp and must not be cached
+      ;; with the locations of the new class.
+      (when (and location-table
+                 (si:instancep instance)
+                 (eql stamp (core:class-stamp-for-instances class)))
+        (let ((location (gethash (cdr cache) location-table nil)))
+          (when (si:fixnump location)
+            (setf (car cache) (vector stamp epoch location))))))))
+
+(defun cached-slot-value-miss (instance cache)
+  (prog1 (slot-value instance (cdr cache))
+    (fill-slot-cache cache instance)))
+
+(defun cached-set-slot-value-miss (value instance cache)
+  (prog1 (setf (slot-value instance (cdr cache)) value)
+    (fill-slot-cache cache instance)))
+
 (defun slot-value (self slot-name)
   (with-early-accessors (+standard-class-slots+
 			 +slot-definition-slots+)
     (let* ((class (class-of self))
 	   (location-table (class-location-table class)))
       (if location-table
-	  (let ((location (gethash slot-name location-table nil)))
+	  (let ((location (progn
+                            (ensure-up-to-date-instance self class)
+                            (gethash slot-name location-table nil))))
 	    (if location
 		(let ((value (standard-instance-access self location)))
 		  (if (si:sl-boundp value)
@@ -233,7 +298,9 @@
     (let* ((class (class-of self))
 	   (location-table (class-location-table class)))
       (if location-table
-	  (let ((location (gethash slot-name location-table nil)))
+	  (let ((location (progn
+                            (ensure-up-to-date-instance self class)
+                            (gethash slot-name location-table nil))))
 	    (if location
 		(si:sl-boundp (standard-instance-access self location))
 		(values (slot-missing class self slot-name 'SLOT-BOUNDP))))
@@ -256,7 +323,9 @@
     (let* ((class (class-of self))
 	   (location-table (class-location-table class)))
       (if location-table
-	  (let ((location (gethash slot-name location-table nil)))
+	  (let ((location (progn
+                            (ensure-up-to-date-instance self class)
+                            (gethash slot-name location-table nil))))
 	    (if location
                 (setf (standard-instance-access self location) value)
 		(slot-missing class self slot-name 'SETF value)))
@@ -176,8 +176,47 @@
         (rename-file temp-bundle-file bundle-file :if-exists :supersede)
         (truename bundle-file)))))
 
+(defparameter *write-source-position-tables* (not (ext:getenv "CLASP_NO_SOURCE_POSITION_TABLES"))
+  "When true and DWARF is generated, a fasl's source position table is written
+next to it as <fasl>.spt when it is linked.  LOAD maps the table so backtraces
+and CORE:LOOKUP-ADDRESS can find source positions without the DWARF.")
+
+(defun maybe-write-source-position-table (fasl)
+  (when (and *write-source-position-tables* *dbg-generate-dwarf*)
+    (llvm-sys:write-source-position-table (namestring fasl))))
+
 (defun execute-link-fasl (in-bundle-file in-all-names &key input-type)
-  (execute-link-library in-bundle-file in-all-names :input-type input-type :output-type :dynamic))
+  (let ((fasl (execute-link-library in-bundle-file in-all-names :input-type input-type :output-type :dynamic)))
+    (maybe-write-source-position-table fasl)
+    fasl))
+
+(defparameter *link-fasls-in-process* (ext:getenv "CLASP_LINK_FASLS_IN_PROCESS")
+  "When true fasls are linked from bitcode with the LLVM linker inside this
+process and written as a native object file rather than linked into a shared
+library by an external linker.  LOAD recognizes such fasls and hands them to
+the JIT, which relocates them without compiling anything.")
+
+(defun execute-link-fasl-in-process (in-bundle-file in-all-names)
+  "Link the bitcode files IN-ALL-NAMES into one module and write it to IN-BUNDLE-FILE
+as an object file.  The intrinsics and builtins are not linked in - the JIT
+resolves them against this process when the fasl is loaded."
+  (let* ((bundle-file (ensure-string in-bundle-file))
+         (temp-bitcode-file (ensure-string (core:mkstemp bundle-file)))
+         (temp-bundle-file (ensure-string (core:mkstemp bundle-file)))
+         (module (link-bitcode-modules temp-bitcode-file in-all-names)))
+    (delete-file temp-bitcode-file)
+    ;; RuntimeDyld won't run the constructors so LOAD calls them through one function
+    (llvm-sys:lower-global-ctors module)
+    (with-open-file (fout temp-bundle-file :direction :output :if-exists :supersede)
+      (let ((reloc-model (cond
+                           ((or (member :target-os-linux *features*) (member :target-os-freebsd *features*))
+                            'llvm-sys:reloc-model-pic-)
+                           (t 'llvm-sys:reloc-model-undefined))))
+        (generate-obj-asm module fout :file-type 'llvm-sys:code-gen-file-type-object-file :reloc-model reloc-model)))
+    (llvm-sys:module-delete module)
+    (rename-file temp-bundle-file bundle-file :if-exists :supersede)
+    (maybe-write-source-position-table (truename bundle-file))
+    (truename bundle-file)))
 
 (defun execute-link-static (in-bundle-file in-all-names &key input-type)
   (execute-link-library in-bundle-file in-all-names :input-type input-type :output-type :static))
@@ -309,6 +348,11 @@ Return the **output-pathname**."
        (when (eq input-type :bitcode)
          (push (core:build-inline-bitcode-pathname link-type :builtins) input-files))
        (execute-link-executable output-pathname input-files :input-type input-type))
+      ((and (eq link-type :fasl)
+            (eq input-type :bitcode)
+            *link-fasls-in-process*
+            (not *use-human-readable-bitcode*))
+       (execute-link-fasl-in-process output-pathname input-files))
       ((eq link-type :fasl)
        (push (core:build-inline-bitcode-pathname link-type :intrinsics) input-files)
        (when (eq input-type :bitcode)
@@ -137,6 +137,8 @@
             irc-basic-block-create
             irc-begin-block
             irc-br
+            irc-safepoint
+            *safepoints*
             irc-branch-to-and-begin-block
             irc-cond-br
             irc-intrinsic-call
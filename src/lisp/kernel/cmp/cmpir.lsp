@@ -531,6 +531,24 @@
       nil))
 
 
+(defvar *safepoints* t
+  "When true compiled code polls clasp_safepoint_word at function entry and
+at loop heads so that interrupts are delivered to threads that never allocate.")
+
+(defun irc-safepoint ()
+  "Poll the global safepoint word and call cc_safepoint when it is set."
+  (when *safepoints*
+    (let* ((word (llvm-sys:get-or-create-external-global *the-module* "clasp_safepoint_word" %i32% 'llvm-sys:external-linkage))
+           (pending (irc-icmp-ne (llvm-sys:create-load-value-bool-twine *irbuilder* word t "safepoint-word")
+                                 (jit-constant-i32 0) "safepoint-pending"))
+           (poll-block (irc-basic-block-create "safepoint-poll"))
+           (cont-block (irc-basic-block-create "safepoint-cont")))
+      (irc-cond-br pending poll-block cont-block)
+      (irc-begin-block poll-block)
+      (irc-intrinsic "cc_safepoint")
+      (irc-br cont-block)
+      (irc-begin-block cont-block))))
+
 (defun irc-begin-landing-pad-block (theblock &optional (function *current-function*))
   "This doesn't invoke low-level-trace - it would interfere with the landing pad"
   (or (llvm-sys:get-parent theblock) (error "irc-begin-landing-pad-block>> The block ~a doesn't have a parent" theblock))
@@ -842,6 +860,7 @@
                      (with-irbuilder (*irbuilder-function-body*)
                        (or *the-module* (error "with-new-function *the-module* is NIL"))
                        (cmp-log "with-landing-pad around body%N")
+                       (irc-safepoint)
                        (progn ,@body))))
                ((cleanup)
                 (irc-cleanup-function-environment ,fn-env)
@@ -473,6 +473,24 @@ env is the parent environment of the (result-af) value frame"
 		      (setq index (+ 1 index))))) code)
     (nreverse result)))
 
+(defun tagbody.tag-mentioned-p (tag form closures-only &optional in-closure)
+  "Return true if TAG appears in FORM outside of quoted data.  With
+CLOSURES-ONLY it must appear inside a FUNCTION, LAMBDA, FLET or LABELS form."
+  (cond ((eq form tag) (or (not closures-only) in-closure))
+        ((and (consp form) (not (eq (car form) 'quote)))
+         (let ((in-closure (or in-closure (member (car form) '(function lambda flet labels)))))
+           (or (tagbody.tag-mentioned-p tag (car form) closures-only in-closure)
+               (tagbody.tag-mentioned-p tag (cdr form) closures-only in-closure))))
+        (t nil)))
+
+(defun tagbody.back-edge-target-p (code tail)
+  "Return true if the tag at TAIL of the TAGBODY body CODE may be reached by a
+jump backwards - from a GO after it, or from a closure made before it that
+may be called after it."
+  (let ((tag (car tail)))
+    (or (tagbody.tag-mentioned-p tag (cdr tail) nil)
+        (tagbody.tag-mentioned-p tag (ldiff code tail) t))))
+
 (defun codegen-tagbody (result rest env)
   "Extract tags and code from (rest) and create an alist that maps
 tag symbols to code and llvm-ir basic-blocks. Store the alist in the symbol-to-block-alist
@@ -515,6 +533,9 @@ jump to blocks within this tagbody."
                                (section (extract-section (caddr tag-begin) (caddr tag-end))))
                           (irc-branch-if-no-terminator-inst section-block)
                           (irc-begin-block section-block)
+                          ;; Only a tag that can be jumped back to heads a loop
+                          (when (tagbody.back-edge-target-p rest (caddr tag-begin))
+                            (irc-safepoint))
                           (codegen-progn result section tagbody-env)
                           (when section-next-block (irc-branch-if-no-terminator-inst section-next-block))
                           ))
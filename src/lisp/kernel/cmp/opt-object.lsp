@@ -36,11 +36,36 @@
 ;;; These macros allow the above FIND-CLASS optimization to be used, avoiding a runtime lookup.
 ;;; They're ordered from most to least important.
 
+;;; With constant initarg keys as well, the call goes through a constructor
+;;; cell that caches a constructor for the class and keys (see CONSTRUCTORS
+;;; in clos/standard.lsp).  The values are still evaluated left to right.
+
+(defun constant-initarg-keys (initargs env)
+  "Return the initarg keys of INITARGS if they are all constant symbols other
+than :ALLOW-OTHER-KEYS, the value forms and T, otherwise NIL."
+  (when (evenp (length initargs))
+    (loop for (key value) on initargs by #'cddr
+          unless (constantp key env)
+            do (return-from constant-initarg-keys nil)
+          collect (let ((key (ext:constant-form-value key env)))
+                    (unless (and (symbolp key) (not (eq key :allow-other-keys)))
+                      (return-from constant-initarg-keys nil))
+                    key)
+            into keys
+          collect value into value-forms
+          finally (return (values keys value-forms t)))))
+
 (define-compiler-macro make-instance (&whole form class &rest initargs &environment env)
   (if (constantp class env)
     (let ((class (ext:constant-form-value class env)))
       (if (symbolp class)
-          `(make-instance (find-class ',class) ,@initargs)
+          (multiple-value-bind (keys value-forms constantp)
+              (constant-initarg-keys initargs env)
+            (if constantp
+                (let ((cell (gensym "CONSTRUCTOR-CELL")))
+                  `(let ((,cell (load-time-value (clos::make-constructor-cell ',class ',keys))))
+                     (funcall (the function (car ,cell)) ,cell ,@value-forms)))
+                `(make-instance (find-class ',class) ,@initargs)))
           form))
     form))
 
@@ -60,3 +85,69 @@
             `(make-instances-obsolete (find-class ',class))
             form))
       form))
+
+;;; SLOT-VALUE with a constant slot name checks a cache at the call site
+;;; before going through the location table (see SLOT CACHES in
+;;; clos/std-slot-value.lsp).  A hit reads the rack directly; anything
+;;; else, including unbound slots, goes through the out of line miss
+;;; function, which does the full SLOT-VALUE and refills the cache.
+;;;
+;;; CLOS itself uses SLOT-VALUE before std-slot-value.lsp is loaded, so
+;;; the cache is only used once the miss functions exist.  The cache is
+;;; made with plain CL at load time and starts out with an entry that
+;;; never matches, so a file compiled in a full image can still be loaded
+;;; into an image that is being built, as long as it isn't run before
+;;; SLOT-VALUE is defined - which it couldn't be anyway.
+
+(defun constant-slot-name (slot-name env)
+  "Return the slot name of SLOT-NAME and T if it is a constant symbol and slot caches are available, otherwise NIL."
+  (when (and (constantp slot-name env)
+             (fboundp 'clos::cached-set-slot-value-miss))
+    (let ((slot-name (ext:constant-form-value slot-name env)))
+      (when (symbolp slot-name)
+        (values slot-name t)))))
+
+(define-compiler-macro slot-value (&whole form object slot-name &environment env)
+  (multiple-value-bind (slot-name constantp)
+      (constant-slot-name slot-name env)
+    (if constantp
+        (let ((object-gs (gensym "OBJECT"))
+              (cache (gensym "SLOT-CACHE"))
+              (entry (gensym "ENTRY"))
+              (value (gensym "VALUE")))
+          `(let* ((,object-gs ,object)
+                  (,cache (load-time-value (cons (vector nil nil nil) ',slot-name)))
+                  (,entry (car ,cache)))
+             (if (and (eql (core:instance-stamp ,object-gs) (svref ,entry 0))
+                      (eql clos::*slot-location-epoch* (svref ,entry 1)))
+                 (let ((,value (si:instance-ref ,object-gs (svref ,entry 2))))
+                   (if (si:sl-boundp ,value)
+                       ,value
+                       (clos::cached-slot-value-miss ,object-gs ,cache)))
+                 (clos::cached-slot-value-miss ,object-gs ,cache))))
+        form)))
+
+;;; Writes go through a SETF expander, since compiler macros for SETF
+;;; functions are not looked up.
+
+(define-setf-expander slot-value (object slot-name &environment env)
+  (let ((object-gs (gensym "OBJECT"))
+        (store (gensym "STORE")))
+    (multiple-value-bind (constant-name constantp)
+        (constant-slot-name slot-name env)
+      (if constantp
+          (let ((cache (gensym "SLOT-CACHE"))
+                (entry (gensym "ENTRY")))
+            (values (list object-gs) (list object) (list store)
+                    `(let* ((,cache (load-time-value (cons (vector nil nil nil) ',constant-name)))
+                            (,entry (car ,cache)))
+                       (if (and (eql (core:instance-stamp ,object-gs) (svref ,entry 0))
+                                (eql clos::*slot-location-epoch* (svref ,entry 1)))
+                           (progn (si:instance-set ,object-gs (svref ,entry 2) ,store)
+                                  ,store)
+                           (clos::cached-set-slot-value-miss ,store ,object-gs ,cache)))
+                    `(slot-value ,object-gs ',constant-name)))
+          (let ((slot-name-gs (gensym "SLOT-NAME")))
+            (values (list object-gs slot-name-gs) (list object slot-name) (list store)
+                    `(funcall #'(setf slot-value) ,store ,object-gs ,slot-name-gs)
+                    `(slot-value ,object-gs ,slot-name-gs)))))))
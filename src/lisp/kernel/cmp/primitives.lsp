@@ -141,6 +141,7 @@
 ;;;    (primitive-unwinds "invokeTopLevelFunction" %void% (list %tmv*% %fn-prototype*% %i8*% %i32*% %size_t% %size_t% %size_t% %ltv**%))
          (primitive-unwinds "cc_register_startup_function" %void% (list %size_t% %fn-start-up*%))
          (primitive         "cc_protect_alloca" %void% (list %i8*%))
+         (primitive-unwinds "cc_safepoint" %void% nil)
     
          (primitive         "cc_trackFirstUnexpectedKeyword" %size_t% (list %size_t% %size_t%))
          (primitive-unwinds "bc_function_from_function_designator" %t*% (list %t*%))
@@ -161,59 +161,23 @@
     (character
      (make-string 1 :initial-element string-designator))))
 
-(defun %verify-string-args (start end real-string)
-  (when (null end)
-    (setq end (length real-string)))
-  (unless (and (numberp start)
-               (numberp end)
-               (<= start end)
-               (>= start 0)
-               (<= end (length real-string)))
-    (error "Bad parameters Start ~s End ~s for ~s" start end real-string))
-  (values start end))
-
-(defmacro %transform-string (real-string new-start new-end predicate transformation)
-  (let ((index1 (gensym))
-	(index2 (gensym))
-	(char (gensym)))
-    `(dotimes (,index1 (- ,new-end ,new-start) , real-string)
-       (let* ((,index2 (+ ,new-start ,index1))
-	      (,char (char ,real-string ,index2)))
-	 (when (,predicate ,char)
-	   (setf (char ,real-string ,index2)
-		 (,transformation ,char)))))))
-  
+;;; The case kernels check START and END and work on the string's own
+;;; character storage, through the unicode tables
 (defun string-upcase (string-designator &key (start 0) end)
-  ;;;string-designator to string
-  (let ((real-string (%real-string string-designator)))
-    (multiple-value-bind
-          (new-start new-end)
-        (%verify-string-args start end real-string)
-      (%transform-string real-string new-start new-end lower-case-p char-upcase))))
+  (core:nstring-upcase-range (%real-string string-designator) start end))
 
 (defun string-downcase (string-designator &key (start 0) end)
-  ;;;string-designator to string
-  (let ((real-string (%real-string string-designator)))
-    (multiple-value-bind
-          (new-start new-end)
-        (%verify-string-args start end real-string)
-      (%transform-string real-string new-start new-end upper-case-p char-downcase))))
+  (core:nstring-downcase-range (%real-string string-designator) start end))
 
 (defun nstring-upcase (real-string &key (start 0) end)
   (unless (stringp real-string)
     (error "Incorrect arguments in nstring-upcase ~s Start ~s End ~s" real-string start end))
-  (multiple-value-bind
-        (new-start new-end)
-      (%verify-string-args start end real-string)
-    (%transform-string real-string new-start new-end lower-case-p char-upcase)))
+  (core:nstring-upcase-range real-string start end))
 
 (defun nstring-downcase (real-string &key (start 0) end)
   (unless (stringp real-string)
     (error "Incorrect arguments in nstring-downcase ~s Start ~s End ~s" real-string start end))
-  (multiple-value-bind
-        (new-start new-end)
-      (%verify-string-args start end real-string)
-    (%transform-string real-string new-start new-end upper-case-p char-downcase)))
+  (core:nstring-downcase-range real-string start end))
 
 (defun float-radix (arg)
   ;; Unless you are internally representing
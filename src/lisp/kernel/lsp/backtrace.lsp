@@ -23,6 +23,7 @@
   arguments                             ; 11
   closure                               ; 12
   function-description                  ; 13
+  source-position                       ; 14 (file line column) from the source position tables
   )
 
 
@@ -209,6 +210,9 @@ Set gather-all-frames to T and you can gather C++ and Common Lisp frames"
                  (prin1 (prog1 index (incf index)) stream)
                  (write-string ": " stream)
                  (princ name stream)))
+           (let ((position (backtrace-frame-source-position e)))
+             (when position
+               (bformat stream "  [%s:%d]" (first position) (second position))))
            (terpri stream)))))
 
 (defun btcl (&key all (args t) (stream *standard-output*))
@@ -218,7 +222,8 @@ Set gather-all-frames to T and you can gather C++ and Common Lisp frames"
      (dump-backtrace raw-backtrace :stream stream :args args :all all))))
 
 (export '(btcl dump-backtrace common-lisp-backtrace-frames
-          backtrace-frame-function-name backtrace-frame-arguments))
+          backtrace-frame-function-name backtrace-frame-arguments
+          backtrace-frame-source-position))
 
 (defmacro with-dtrace-trigger (&body body)
   `(unwind-protect
@@ -51,6 +51,14 @@
   (get-sysprop name 'structure-slot-descriptions))
 (defun (setf structure-slot-descriptions) (descriptions name)
   (put-sysprop name 'structure-slot-descriptions descriptions))
+(defun structure-rack-slots (name)
+  (get-sysprop name 'structure-rack-slots))
+(defun (setf structure-rack-slots) (slot-names name)
+  (put-sysprop name 'structure-rack-slots slot-names))
+(defun structure-raw-layout (name)
+  (get-sysprop name 'structure-raw-layout))
+(defun (setf structure-raw-layout) (layout name)
+  (put-sysprop name 'structure-raw-layout layout))
 (defun structure-constructor (name)
   (get-sysprop name 'structure-constructor))
 (defun (setf structure-constructor) (constructor name)
@@ -383,6 +391,94 @@
      ,@(when copier
             `((defun ,copier (instance) (copy-list instance))))))
 
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;
+;;; Unboxed slots
+;;;
+;;; A slot of a structure class whose type upgrades to one of the element
+;;; types below is not kept in the instance rack.  All such raw slots with
+;;; the same element type share a specialized vector, kept in a storage
+;;; slot of the rack instead.  The GC does not scan these vectors, writes
+;;; store the number itself, and reads need no type check.
+;;;
+;;; A structure's new storage slots come after its own boxed slots.  A
+;;; structure that :INCLUDEs another keeps the rack indices and raw
+;;; offsets of the included one, so the included accessors still work.
+;;; STRUCTURE-RACK-SLOTS is the list of slot names in rack order, and
+;;; STRUCTURE-RAW-LAYOUT has an entry (name storage offset element-type)
+;;; for each raw slot.
+
+(defparameter +raw-slot-storage+
+  ;; Keyed by what UPGRADED-ARRAY-ELEMENT-TYPE returns.
+  '((double-float . %raw-double-float)
+    (single-float . %raw-single-float)
+    (fixnum . %raw-fixnum)
+    (ext:integer64 . %raw-signed-byte-64)
+    (ext:byte64 . %raw-unsigned-byte-64)
+    (ext:integer32 . %raw-signed-byte-32)
+    (ext:byte32 . %raw-unsigned-byte-32)
+    (ext:integer16 . %raw-signed-byte-16)
+    (ext:byte16 . %raw-unsigned-byte-16)
+    (ext:integer8 . %raw-signed-byte-8)
+    (ext:byte8 . %raw-unsigned-byte-8)))
+
+(defun raw-slot-element-type (type)
+  "Return the storage element type for a slot of TYPE, or NIL if it is boxed."
+  (unless (eq type t)
+    (let ((upgraded (upgraded-array-element-type type)))
+      (when (assoc upgraded +raw-slot-storage+)
+        upgraded))))
+
+(defun raw-slot-storage-name-p (slot-name)
+  (and (rassoc slot-name +raw-slot-storage+) t))
+
+(defun raw-slot-zero (element-type)
+  (if (subtypep element-type 'float) (coerce 0 element-type) 0))
+
+(defun compute-struct-class-layout (include slot-descriptions)
+  "Return the rack slot names and the raw slot layout of a structure
+INCLUDEing INCLUDE with its own SLOT-DESCRIPTIONS."
+  (let ((rack (when include
+                (or (structure-rack-slots include)
+                    (mapcar #'struct-slotd-name (structure-slot-descriptions include)))))
+        (raw (when include (structure-raw-layout include)))
+        (own-boxed '())
+        (new-storage '()))
+    (dolist (sd slot-descriptions)
+      (let ((element-type (raw-slot-element-type (struct-slotd-type sd))))
+        (if element-type
+            (let ((storage (cdr (assoc element-type +raw-slot-storage+))))
+              (unless (or (member storage rack) (member storage new-storage))
+                (push storage new-storage))
+              (setf raw (append raw (list (list (struct-slotd-name sd) storage
+                                                (count storage raw :key #'second)
+                                                element-type)))))
+            (push (struct-slotd-name sd) own-boxed))))
+    (values (append rack (nreverse own-boxed) (nreverse new-storage)) raw)))
+
+(defun raw-slot-storage-sizes (raw-layout)
+  "Return a list of (storage element-type size) for RAW-LAYOUT."
+  (let ((sizes '()))
+    (dolist (entry raw-layout (nreverse sizes))
+      (destructuring-bind (slot-name storage offset element-type) entry
+        (declare (ignore slot-name))
+        (let ((size (assoc storage sizes)))
+          (if size
+              (setf (third size) (max (third size) (1+ offset)))
+              (push (list storage element-type (1+ offset)) sizes)))))))
+
+(defun raw-slot-storage-form (element-type size)
+  `(make-array ,size :element-type ',element-type
+                     :initial-element ,(raw-slot-zero element-type)))
+
+(defun raw-slot-place (instance rack-slots raw-entry)
+  "Return the place for the raw slot described by RAW-ENTRY of INSTANCE."
+  (destructuring-bind (slot-name storage offset element-type) raw-entry
+    (declare (ignore slot-name))
+    `(aref (the (simple-array ,element-type (*))
+                (si:instance-ref ,instance ,(position storage rack-slots)))
+           ,offset)))
+
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 ;;;
 ;;; DEFSTRUCT class (no :type)
@@ -394,39 +490,82 @@
     `(,name :initform ,initform :type ,type
             :initarg ,(intern (symbol-name name) "KEYWORD"))))
 
-(defmacro define-class-struct-constructors (name constructors slot-descriptions)
-  `(progn
-     ,@(mapcan (lambda (constructor)
-                 (multiple-value-bind (constructor-name lambda-list ftype-parameters vars)
-                     ;; this does most of the work. for example, initforms are set up
-                     ;; in the lambda list.
-                     (constructor-helper constructor slot-descriptions)
-                   (list `(declaim (ftype (function ,ftype-parameters ,name)
-                                          ,constructor-name)) ; useless atm
-                         (let ((instance (gensym "INSTANCE"))
-                               (index 0))
-                           `(defun ,constructor-name ,lambda-list
-                              (let ((,instance
-                                      (allocate-instance
-                                       ;; The class is not immediately available at l-t-v time-
-                                       ;; because the defclass form must be evaluated first.
-                                       ;; Thus, bullshit.
-                                       (let ((class (load-time-value (list nil))))
-                                         (or (car class) (car (rplaca class (find-class ',name))))))))
-                                ,@(mapcar (lambda (var)
-                                            (prog1 `(si:instance-set ,instance ,index ,var)
-                                              (incf index)))
-                                          vars)
-                                ,instance))))))
-               constructors)))
-
-(defmacro define-class-struct-accessors (name conc-name slot-descriptions)
-  (let ((index 0))
-    (flet ((one (sd)
-             (destructuring-bind (slot-name initform type read-only) sd
-               (declare (ignore initform))
-               (prog1
-                   (let* ((accname (struct-reader-name slot-name conc-name))
+(defmacro define-class-struct-constructors (name constructors slot-descriptions
+                                            rack-slots raw-layout)
+  ;; Raw slots without an initform start out as zero rather than NIL.
+  (let ((slot-descriptions
+          (mapcar (lambda (sd)
+                    (let ((raw (assoc (struct-slotd-name sd) raw-layout)))
+                      (if (and raw (null (struct-slotd-initform sd)))
+                          (make-struct-slotd (struct-slotd-name sd)
+                                             (raw-slot-zero (fourth raw))
+                                             (struct-slotd-type sd)
+                                             (struct-slotd-read-only sd))
+                          sd)))
+                  slot-descriptions)))
+    `(progn
+       ,@(mapcan (lambda (constructor)
+                   (multiple-value-bind (constructor-name lambda-list ftype-parameters vars)
+                       ;; this does most of the work. for example, initforms are set up
+                       ;; in the lambda list.
+                       (constructor-helper constructor slot-descriptions)
+                     (list `(declaim (ftype (function ,ftype-parameters ,name)
+                                            ,constructor-name)) ; useless atm
+                           (let ((instance (gensym "INSTANCE")))
+                             `(defun ,constructor-name ,lambda-list
+                                (let ((,instance
+                                        (allocate-instance
+                                         ;; The class is not immediately available at l-t-v time-
+                                         ;; because the defclass form must be evaluated first.
+                                         ;; Thus, bullshit.
+                                         (let ((class (load-time-value (list nil))))
+                                           (or (car class) (car (rplaca class (find-class ',name))))))))
+                                  ,@(mapcar (lambda (storage-size)
+                                              (destructuring-bind (storage element-type size)
+                                                  storage-size
+                                                `(si:instance-set ,instance ,(position storage rack-slots)
+                                                                  ,(raw-slot-storage-form element-type size))))
+                                            (raw-slot-storage-sizes raw-layout))
+                                  ,@(mapcar (lambda (sd var)
+                                              (let ((raw (assoc (struct-slotd-name sd) raw-layout)))
+                                                (if raw
+                                                    `(setf ,(raw-slot-place instance rack-slots raw) ,var)
+                                                    `(si:instance-set ,instance
+                                                                      ,(position (struct-slotd-name sd) rack-slots)
+                                                                      ,var))))
+                                            slot-descriptions vars)
+                                  ,instance))))))
+                 constructors))))
+
+(defmacro define-class-struct-accessors (name conc-name slot-descriptions
+                                        rack-slots raw-layout)
+  (flet ((one (sd)
+           (destructuring-bind (slot-name initform type read-only) sd
+             (declare (ignore initform))
+             (let ((accname (struct-reader-name slot-name conc-name))
+                   (raw (assoc slot-name raw-layout)))
+               (if raw
+                   ;; The storage vector already holds only numbers of the
+                   ;; element type, so only a narrower type is asserted.
+                   (let* ((element-type (fourth raw))
+                          (narrower (not (equal type element-type))))
+                     (list* `(declaim (ftype (function (,name) ,type) ,accname) ; useless
+                                      (inline ,accname))
+                            `(defun ,accname (instance)
+                               (declare (type ,name instance))
+                               ,(if narrower
+                                    `(the ,type ,(raw-slot-place 'instance rack-slots raw))
+                                    (raw-slot-place 'instance rack-slots raw)))
+                            (if read-only
+                                nil
+                                `((defsetf ,accname (object) (new)
+                                    (list 'setf
+                                          (subst (list 'the ',name object) 'object
+                                                 ',(raw-slot-place 'object rack-slots raw))
+                                          ,(if narrower
+                                               `(list 'the ',type new)
+                                               'new)))))))
+                   (let* ((index (position slot-name rack-slots))
                           (writer
                             (if read-only
                                 nil
@@ -442,54 +581,68 @@
                                ;; FIXME: remove decls once ftype can take care of it.
                                (declare (type ,name instance))
                                (the ,type (si:instance-ref instance ,index)))
-                            writer))
-                 (incf index)))))
-      `(progn ,@(mapcan #'one slot-descriptions)))))
+                            writer)))))))
+    `(progn ,@(mapcan #'one slot-descriptions))))
 
 (defmacro define-class-struct (name conc-name include slot-descriptions
                                overwriting-slot-descriptions print-function
                                print-object constructors predicate
                                copier documentation
                                &environment env)
-  `(progn
-     (defclass ,name ,(and include (list include))
-       ;; defclass of course does its own overwriting, so we can just leave these be
-       (,@(mapcar #'defstruct-sd->defclass-sd overwriting-slot-descriptions)
-        ,@(mapcar #'defstruct-sd->defclass-sd slot-descriptions))
-       ,@(when documentation
-           `((:documentation ,documentation)))
-       (:metaclass structure-class))
-     ,@(when print-function
-         ;; print-function and print-object can be lambda exprs,
-         ;; so we have to be safe about names.
-         (let ((obj (gensym "OBJ")) (stream (gensym "STREAM")))
-           `((defmethod print-object ((,obj ,name) ,stream)
-               (,print-function ,obj ,stream 0)))))
-     ,@(when print-object
-         (let ((obj (gensym "OBJ")) (stream (gensym "STREAM")))
-           `((defmethod print-object ((,obj ,name) ,stream)
-               (,print-object ,obj ,stream)))))
-     ,@(when predicate
-         ;; generic functions are now fast enough that this is
-         ;; faster code than calling SUBCLASSP or whatnot.
-         `((defgeneric ,predicate (object)
-             (:method (object) nil)
-             (:method ((object ,name)) t))))
-     ,@(when copier
-         ;; It might seem like we can do better here- basically copy
-         ;; a fixed number of slots - but CLHS is clear that the copier
-         ;; must be COPY-STRUCTURE, and so it has to deal correctly with subclasses.
-         `((declaim (ftype (function (,name) ,name) ,copier) ; useless atm
-                    (inline ,copier))
-             (defun ,copier (instance) (copy-structure instance))))
-
-     ,@(with-defstruct-delay (all-slots name include
-                              slot-descriptions overwriting-slot-descriptions env)
-         `((eval-when (:compile-toplevel :load-toplevel :execute)
-               (setf (structure-size ',name) ,(length all-slots)
-                     (structure-slot-descriptions ',name) ',all-slots))
-           (define-class-struct-constructors ,name ,constructors ,all-slots)
-           (define-class-struct-accessors ,name ,conc-name ,all-slots)))))
+  (multiple-value-bind (rack-slots raw-layout)
+      (compute-struct-class-layout include slot-descriptions)
+    `(progn
+       (defclass ,name ,(and include (list include))
+         ;; defclass of course does its own overwriting, so we can just leave these be
+         (,@(mapcar #'defstruct-sd->defclass-sd
+                    (remove-if (lambda (sd) (assoc (struct-slotd-name sd) raw-layout))
+                               overwriting-slot-descriptions))
+          ,@(mapcar #'defstruct-sd->defclass-sd
+                    (remove-if (lambda (sd) (assoc (struct-slotd-name sd) raw-layout))
+                               slot-descriptions))
+          ;; Storage slots of included structures are repeated to size them.
+          ,@(mapcar (lambda (storage-size)
+                      (destructuring-bind (storage element-type size) storage-size
+                        `(,storage :initform ,(raw-slot-storage-form element-type size))))
+                    (raw-slot-storage-sizes raw-layout)))
+         ,@(when documentation
+             `((:documentation ,documentation)))
+         (:metaclass structure-class))
+       ,@(when print-function
+           ;; print-function and print-object can be lambda exprs,
+           ;; so we have to be safe about names.
+           (let ((obj (gensym "OBJ")) (stream (gensym "STREAM")))
+             `((defmethod print-object ((,obj ,name) ,stream)
+                 (,print-function ,obj ,stream 0)))))
+       ,@(when print-object
+           (let ((obj (gensym "OBJ")) (stream (gensym "STREAM")))
+             `((defmethod print-object ((,obj ,name) ,stream)
+                 (,print-object ,obj ,stream)))))
+       ,@(when predicate
+           ;; generic functions are now fast enough that this is
+           ;; faster code than calling SUBCLASSP or whatnot.
+           `((defgeneric ,predicate (object)
+               (:method (object) nil)
+               (:method ((object ,name)) t))))
+       ,@(when copier
+           ;; It might seem like we can do better here- basically copy
+           ;; a fixed number of slots - but CLHS is clear that the copier
+           ;; must be COPY-STRUCTURE, and so it has to deal correctly with subclasses.
+           `((declaim (ftype (function (,name) ,name) ,copier) ; useless atm
+                      (inline ,copier))
+               (defun ,copier (instance) (copy-structure instance))))
+
+       ,@(with-defstruct-delay (all-slots name include
+                                slot-descriptions overwriting-slot-descriptions env)
+           `((eval-when (:compile-toplevel :load-toplevel :execute)
+                 (setf (structure-size ',name) ,(length all-slots)
+                       (structure-slot-descriptions ',name) ',all-slots
+                       (structure-rack-slots ',name) ',rack-slots
+                       (structure-raw-layout ',name) ',raw-layout))
+             (define-class-struct-constructors ,name ,constructors ,all-slots
+               ,rack-slots ,raw-layout)
+             (define-class-struct-accessors ,name ,conc-name ,all-slots
+               ,rack-slots ,raw-layout))))))
 
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
 ;;;
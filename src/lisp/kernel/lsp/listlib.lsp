@@ -19,35 +19,66 @@
        (funcall ,key ,element)
      ,element))
 
+;;; With more than this many elements on both sides the set functions,
+;;; and REMOVE-DUPLICATES/DELETE-DUPLICATES in seqlib, hash the keys
+;;; instead of comparing every pair of elements.
+(defconstant +hash-set-threshold+ 32)
+
+(defun hash-set-test (test test-not)
+  "Return the hash table test that is equivalent to TEST/TEST-NOT or NIL."
+  (unless test-not
+    (cond ((null test) 'eql)
+          ((or (eq test 'eql) (eq test #'eql)) 'eql)
+          ((or (eq test 'eq) (eq test #'eq)) 'eq)
+          ((or (eq test 'equal) (eq test #'equal)) 'equal)
+          ((or (eq test 'equalp) (eq test #'equalp)) 'equalp))))
+
+(defun make-hash-set (list probes test test-not key)
+  "Return a hash table of the keys of LIST when the test can be hashed and
+both LIST and PROBES are long enough for hashing to pay off, otherwise NIL."
+  (let ((hash-test (hash-set-test test test-not)))
+    (when (and hash-test
+               (nthcdr +hash-set-threshold+ list)
+               (nthcdr +hash-set-threshold+ probes))
+      (let ((table (make-hash-table :test hash-test :size (length list))))
+        (dolist (elt list table)
+          (setf (gethash (apply-key key elt) table) t))))))
+
+(defmacro set-member-p (item list table test test-not key)
+  `(if ,table
+       (gethash (apply-key ,key ,item) ,table)
+       (member1 ,item ,list ,test ,test-not ,key)))
 
 (defun union (list1 list2 &key test test-not key)
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Returns, as a list, the union of elements in LIST1 and in LIST2."
-  (do ((x list1 (cdr x))
-       (first) (last))
-      ((null x)
-       (when last (rplacd last list2))
-       (or first list2))
-    (unless (member1 (car x) list2 test test-not key)
-      (if last
-	  (progn (rplacd last (cons (car x) nil))
-		 (setq last (cdr last)))
-	  (progn (setq first (cons (car x) nil))
-		 (setq last first))))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (first) (last))
+        ((null x)
+         (when last (rplacd last list2))
+         (or first list2))
+      (unless (set-member-p (car x) list2 table test test-not key)
+        (if last
+            (progn (rplacd last (cons (car x) nil))
+                   (setq last (cdr last)))
+            (progn (setq first (cons (car x) nil))
+                   (setq last first)))))))
 
 (defun nunion (list1 list2 &key test test-not key)
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Destructive UNION.  Both LIST1 and LIST2 may be destroyed."
-  (do ((x list1 (cdr x))
-       (first) (last))
-      ((null x)
-       (when last (rplacd last list2))
-       (or first list2))
-    (unless (member1 (car x) list2 test test-not key)
-      (if last
-	  (rplacd last x)
-	  (setq first x))
-      (setq last x))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (first) (last))
+        ((null x)
+         (when last (rplacd last list2))
+         (or first list2))
+      (unless (set-member-p (car x) list2 table test test-not key)
+        (if last
+            (rplacd last x)
+            (setq first x))
+        (setq last x)))))
 
 (defun adjoin (item list &key key (test #'eql) test-not)
   "Add ITEM to LIST unless it is already a member."
@@ -62,49 +93,53 @@ Destructive UNION.  Both LIST1 and LIST2 may be destroyed."
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Returns a list consisting of those objects that are elements of both LIST1 and
 LIST2."
-  (do ((x list1 (cdr x))
-       (ans))
-      ((null x)
-       (nreverse ans)) ; optional nreverse: not required by CLtL
-    (when (member1 (car x) list2 test test-not key)
-        (push (car x) ans))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (ans))
+        ((null x)
+         (nreverse ans)) ; optional nreverse: not required by CLtL
+      (when (set-member-p (car x) list2 table test test-not key)
+          (push (car x) ans)))))
 
 (defun nintersection (list1 list2 &key test test-not key)
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Destructive INTERSECTION.  Only LIST1 may be destroyed."
-  (do ((x list1 (cdr x))
-       (first) (last))
-      ((null x)
-       (when last (rplacd last nil))
-       first)
-    (when (member1 (car x) list2 test test-not key)
-      (if last
-	  (rplacd last x)
-	  (setq first x))
-      (setq last x))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (first) (last))
+        ((null x)
+         (when last (rplacd last nil))
+         first)
+      (when (set-member-p (car x) list2 table test test-not key)
+        (if last
+            (rplacd last x)
+            (setq first x))
+        (setq last x)))))
 
 (defun set-difference (list1 list2 &key test test-not key)
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Returns, as a list, those elements of LIST1 that are not elements of LIST2."
-  (do ((x list1 (cdr x))
-       (ans))
-      ((null x) (nreverse ans))
-    (unless (member1 (car x) list2 test test-not key)
-      (push (car x) ans))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (ans))
+        ((null x) (nreverse ans))
+      (unless (set-member-p (car x) list2 table test test-not key)
+        (push (car x) ans)))))
 
 (defun nset-difference (list1 list2 &key test test-not key)
   "Args: (list1 list2 &key (key #'identity) (test #'eql) test-not)
 Destructive SET-DIFFERENCE.  Only LIST1 may be destroyed."
-  (do ((x list1 (cdr x))
-       (first) (last))
-      ((null x)
-       (when last (rplacd last nil))
-       first)
-    (unless (member1 (car x) list2 test test-not key)
-      (if last
-	  (rplacd last x)
-	  (setq first x))
-      (setq last x))))
+  (let ((table (make-hash-set list2 list1 test test-not key)))
+    (do ((x list1 (cdr x))
+         (first) (last))
+        ((null x)
+         (when last (rplacd last nil))
+         first)
+      (unless (set-member-p (car x) list2 table test test-not key)
+        (if last
+            (rplacd last x)
+            (setq first x))
+        (setq last x)))))
 
 (defun swap-args (f)
   (and f #'(lambda (x y) (funcall f y x))))
@@ -324,25 +324,39 @@
 	  :start start :end end :from-end from-end :count count
 	  :test-not #'unsafe-funcall1 :key key))
 
+(defmacro bit-vector-search-p (item sequence test test-not key)
+  "True when looking for ITEM in SEQUENCE can use the word at a time bit vector kernels."
+  `(and (bit-vector-p ,sequence) (typep ,item 'bit) (null ,test-not) (null ,key)
+        (or (null ,test) (eq ,test 'eql) (eq ,test #'eql) (eq ,test 'eq) (eq ,test #'eq))))
+
+(defmacro string-search-p (item sequence test test-not key)
+  "True when looking for ITEM in SEQUENCE can use the memchr based string kernels."
+  `(and (stringp ,sequence) (characterp ,item) (null ,test-not) (null ,key)
+        (or (null ,test) (eq ,test 'eql) (eq ,test #'eql) (eq ,test 'eq) (eq ,test #'eq)
+            (eq ,test 'char=) (eq ,test #'char=))))
+
 (defun count (item sequence &key test test-not from-end (start 0) end key)
-  (with-tests (test test-not key)
-    (declare (optimize (speed 3) (safety 0) (debug 0)))
-    (with-start-end (start end sequence l)
-      (let ((counter 0))
-	(declare (fixnum counter))
-	(if from-end
-	    (if (listp sequence)
-                (count item (reverse sequence)
-                       :start (- l end) :end (- l start)
-                       :test test :test-not test-not :key key)
-		(do-vector (elt sequence start end :from-end t
-                                :output counter)
-		  (when (compare item (key elt))
-		    (incf counter))))
-	    (do-sequence (elt sequence start end :specialize t
-                              :output counter)
-	      (when (compare item (key elt))
-		(incf counter))))))))
+  (if (bit-vector-search-p item sequence test test-not key)
+      (with-start-end (start end sequence)
+        (core:bit-vector-count sequence item start end))
+      (with-tests (test test-not key)
+        (declare (optimize (speed 3) (safety 0) (debug 0)))
+        (with-start-end (start end sequence l)
+          (let ((counter 0))
+            (declare (fixnum counter))
+            (if from-end
+                (if (listp sequence)
+                    (count item (reverse sequence)
+                           :start (- l end) :end (- l start)
+                           :test test :test-not test-not :key key)
+                    (do-vector (elt sequence start end :from-end t
+                                    :output counter)
+                      (when (compare item (key elt))
+                        (incf counter))))
+                (do-sequence (elt sequence start end :specialize t
+                                  :output counter)
+                  (when (compare item (key elt))
+                    (incf counter)))))))))
 
 (defun count-if (predicate sequence &key from-end (start 0) end key)
   (count (coerce-fdesignator predicate) sequence
@@ -414,17 +428,24 @@
 
 
 (defun find (item sequence &key test test-not (start 0) end from-end key)
-  (with-tests (test test-not key)
-    (declare (optimize (speed 3) (safety 0) (debug 0)))
-    (with-start-end (start end sequence length)
-      (declare (ignore length))
-      (let ((output nil))
-        (do-sequence (elt sequence start end
-                          :output output :index index :specialize t)
-          (when (compare item (key elt))
-            (unless from-end
-              (return elt))
-            (setf output elt)))))))
+  (cond
+    ((bit-vector-search-p item sequence test test-not key)
+     (with-start-end (start end sequence)
+       (and (core:bit-vector-position sequence item start end from-end) item)))
+    ((string-search-p item sequence test test-not key)
+     (and (core:string-position-char item sequence start end from-end) item))
+    (t
+     (with-tests (test test-not key)
+       (declare (optimize (speed 3) (safety 0) (debug 0)))
+       (with-start-end (start end sequence length)
+         (declare (ignore length))
+         (let ((output nil))
+           (do-sequence (elt sequence start end
+                             :output output :index index :specialize t)
+             (when (compare item (key elt))
+               (unless from-end
+                 (return elt))
+               (setf output elt)))))))))
 
 (defun find-if (predicate sequence &key from-end (start 0) end key)
   (find (coerce-fdesignator predicate) sequence
@@ -438,16 +459,23 @@
 
 
 (defun position (item sequence &key test test-not from-end (start 0) end key)
-  (with-tests (test test-not key)
-    (declare (optimize (speed 3) (safety 0) (debug 0)))
-    (with-start-end (start end sequence)
-      (let ((output nil))
-        (do-sequence (elt sequence start end
-                      :output output :index index :specialize t)
-          (when (compare item (key elt))
-            (unless from-end
-              (return index))
-            (setf output index)))))))
+  (cond
+    ((bit-vector-search-p item sequence test test-not key)
+     (with-start-end (start end sequence)
+       (core:bit-vector-position sequence item start end from-end)))
+    ((string-search-p item sequence test test-not key)
+     (core:string-position-char item sequence start end from-end))
+    (t
+     (with-tests (test test-not key)
+       (declare (optimize (speed 3) (safety 0) (debug 0)))
+       (with-start-end (start end sequence)
+         (let ((output nil))
+           (do-sequence (elt sequence start end
+                         :output output :index index :specialize t)
+             (when (compare item (key elt))
+               (unless from-end
+                 (return index))
+               (setf output index)))))))))
 
 (defun position-if (predicate sequence &key from-end (start 0) end key)
   (position (coerce-fdesignator predicate) sequence
@@ -459,10 +487,92 @@
             :from-end from-end :start start :end end
             :test-not #'unsafe-funcall1 :key key))
 
+;;; Hashed versions of the duplicate removers, used when the test is
+;;; one of EQ, EQL, EQUAL or EQUALP and the range is longer than
+;;; +HASH-SET-THRESHOLD+ (see listlib).  When FROM-END the first
+;;; occurrence of a key is kept, otherwise the last one: the keys are
+;;; counted first and an element is kept when its count drops to zero.
+
+(defmacro hashed-key-kept-p (table key from-end)
+  (with-unique-names (%key)
+    `(let ((,%key ,key))
+       (if ,from-end
+           (unless (gethash ,%key ,table)
+             (setf (gethash ,%key ,table) t))
+           (zerop (decf (the fixnum (gethash ,%key ,table))))))))
+
+(defun remove-duplicates-list-hashed (sequence start end from-end hash-test key)
+  (declare (fixnum start end))
+  (with-key (key)
+    (let ((output nil)
+          (table (make-hash-table :test hash-test :size (- end start))))
+      (dotimes (i start)
+        (setf output (cons (car (the cons sequence)) output)
+              sequence (cdr (the cons sequence))))
+      (let ((tail (nthcdr (- end start) sequence)))
+        (unless from-end
+          (do ((l sequence (cdr (the cons l))))
+              ((eq l tail))
+            (incf (the fixnum (gethash (key (car (the cons l))) table 0)))))
+        (do ((l sequence (cdr (the cons l))))
+            ((eq l tail) (nreconc output tail))
+          (let ((elt (car (the cons l))))
+            (when (hashed-key-kept-p table (key elt) from-end)
+              (push elt output))))))))
+
+(defun delete-duplicates-list-hashed (sequence start end from-end hash-test key)
+  (declare (fixnum start end))
+  (with-key (key)
+    (let* ((output (cons nil sequence))
+           (splice output)
+           (table (make-hash-table :test hash-test :size (- end start))))
+      (dotimes (i start)
+        (setf splice (cdr (the cons splice))
+              sequence (cdr (the cons sequence))))
+      (let ((tail (nthcdr (- end start) sequence)))
+        (unless from-end
+          (do ((l sequence (cdr (the cons l))))
+              ((eq l tail))
+            (incf (the fixnum (gethash (key (car (the cons l))) table 0)))))
+        (loop
+           (when (eq sequence tail)
+             (return (cdr (the cons output))))
+           (if (hashed-key-kept-p table (key (car (the cons sequence))) from-end)
+               (setf splice sequence
+                     sequence (cdr (the cons sequence)))
+               (setf sequence (cdr (the cons sequence))
+                     (cdr splice) sequence)))))))
+
+(defun filter-duplicates-vector-hashed (out in start end length from-end hash-test key)
+  (declare (fixnum start end length))
+  (with-key (key)
+    (let ((table (make-hash-table :test hash-test :size (- end start)))
+          (jndex start))
+      (declare (fixnum jndex))
+      (unless from-end
+        (do ((index start (1+ index)))
+            ((= index end))
+          (declare (fixnum index))
+          (incf (the fixnum (gethash (key (aref in index)) table 0)))))
+      (do ((index start (1+ index)))
+          ((= index end))
+        (declare (fixnum index))
+        (let ((elt (aref in index)))
+          (when (hashed-key-kept-p table (key elt) from-end)
+            (when out
+              (setf (aref (the vector out) jndex) elt))
+            (setf jndex (1+ jndex)))))
+      (when out (copy-subarray out jndex in end length))
+      (+ jndex (- length end)))))
+
 (defun remove-duplicates-list (sequence start end from-end test test-not key)
   (with-tests (test test-not key)
     (declare (optimize (speed 3) (safety 0) (debug 0) (space 0)))
     (with-start-end (start end sequence)
+      (let ((hash-test (hash-set-test test test-not)))
+        (when (and hash-test (> (- end start) +hash-set-threshold+))
+          (return-from remove-duplicates-list
+            (remove-duplicates-list-hashed sequence start end from-end hash-test key))))
       (let* ((output nil))
         (while (and sequence (plusp start))
           (setf output (cons (car (the cons sequence)) output)
@@ -525,6 +635,10 @@ Returns a copy of SEQUENCE without duplicated elements."
   (with-tests (test test-not key)
     (declare (optimize (speed 3) (safety 0) (debug 0) (space 0)))
     (with-start-end (start end sequence)
+      (let ((hash-test (hash-set-test test test-not)))
+        (when (and hash-test (> (- end start) +hash-set-threshold+))
+          (return-from delete-duplicates-list
+            (delete-duplicates-list-hashed sequence start end from-end hash-test key))))
       (let* ((splice (cons nil sequence))
              (output splice))
         (while (and sequence (plusp start))
@@ -565,6 +679,10 @@ Returns a copy of SEQUENCE without duplicated elements."
     (with-start-end (start end in length)
       (when (and out (not (eq out in)))
         (copy-subarray out 0 in 0 start))
+      (let ((hash-test (hash-set-test test test-not)))
+        (when (and hash-test (> (- end start) +hash-set-threshold+))
+          (return-from filter-duplicates-vector
+            (filter-duplicates-vector-hashed out in start end length from-end hash-test key))))
       (flet ((already-in-vector-p (sequence start current end from-end)
                (declare (vector sequence)
                         (fixnum start current end))
@@ -672,6 +790,10 @@ subsequence is found.  Returns NIL otherwise."
     ((and (stringp sequence1) (stringp sequence2)
           (not from-end) (not test) (not test-not) (not key))
      (search-string sequence1 start1 end1 sequence2 start2 end2))
+    ((and (stringp sequence1) (stringp sequence2)
+          (not from-end) (or (eq test 'char-equal) (eq test #'char-equal))
+          (not test-not) (not key))
+     (search-string-equal sequence1 start1 end1 sequence2 start2 end2))
     ((and (vectorp sequence1) (vectorp sequence2))
      (search-vector sequence1 start1 end1 sequence2 start2 end2
                     test test-not key from-end))
@@ -154,3 +154,125 @@
 
 
 
+
+;;; The word at a time kernels in bits.cc: unaligned BIT-x operations,
+;;; COUNT and POSITION with ranges and EQUAL on bit vectors that start
+;;; inside a word.  Results are checked against a bit by bit loop, at
+;;; lengths and offsets around the 32 bit word boundary.
+
+(defparameter *bit-kernel-lengths* '(0 1 31 32 33 63 64 65 130))
+(defparameter *bit-kernel-offsets* '(0 1 7 31 32 33))
+
+(defun pattern-bit-vector (n seed)
+  (let ((v (make-array n :element-type 'bit))
+        (x seed))
+    (dotimes (i n v)
+      (setf x (mod (+ (* x 1103515245) 12345) 2147483648))
+      (setf (sbit v i) (ldb (byte 1 16) x)))))
+
+(defun displaced-bit-vector (contents offset)
+  "Return a bit vector with CONTENTS that starts OFFSET bits into its storage."
+  (let ((base (make-array (+ offset (length contents) 3) :element-type 'bit :initial-element 1)))
+    (replace (make-array (length contents) :element-type 'bit
+                                           :displaced-to base
+                                           :displaced-index-offset offset)
+             contents)))
+
+(defun reference-bit-op (op x y)
+  (let ((r (make-array (length x) :element-type 'bit)))
+    (dotimes (i (length x) r)
+      (setf (aref r i) (logand 1 (funcall op (aref x i) (aref y i)))))))
+
+(defun check-bit-op (function op)
+  (loop for n in *bit-kernel-lengths*
+        always (loop for ox in *bit-kernel-offsets*
+                     always (loop for oy in *bit-kernel-offsets*
+                                  for x = (pattern-bit-vector n (+ n ox))
+                                  for y = (pattern-bit-vector n (+ n oy 1000))
+                                  for expected = (reference-bit-op op x y)
+                                  for dx = (displaced-bit-vector x ox)
+                                  for dy = (displaced-bit-vector y oy)
+                                  for dr = (displaced-bit-vector (make-array n :element-type 'bit) (mod (+ ox oy) 37))
+                                  always (and (equal expected (funcall function dx dy))
+                                              (equal expected (funcall function dx dy dr))
+                                              (equal expected dr)
+                                              ;; the result is the first argument
+                                              (equal expected (funcall function dx dy t))
+                                              (equal expected dx))))))
+
+(test bit-and-unaligned (check-bit-op 'bit-and #'logand))
+(test bit-xor-unaligned (check-bit-op 'bit-xor #'logxor))
+(test bit-ior-unaligned (check-bit-op 'bit-ior #'logior))
+(test bit-andc2-unaligned (check-bit-op 'bit-andc2 (lambda (a b) (logand a (- 1 b)))))
+
+(defun reference-count (bit v start end)
+  (loop for i from start below end count (= bit (aref v i))))
+
+(defun reference-position (bit v start end from-end)
+  (if from-end
+      (loop for i from (1- end) downto start when (= bit (aref v i)) return i)
+      (loop for i from start below end when (= bit (aref v i)) return i)))
+
+(defparameter *bit-kernel-bounds* '(0 1 30 31 32 33 63 64 65 129 130))
+
+(defun check-bit-ranges (function)
+  (loop for n in *bit-kernel-lengths*
+        always (loop for offset in *bit-kernel-offsets*
+                     for v = (displaced-bit-vector (pattern-bit-vector n offset) offset)
+                     always (loop for start in *bit-kernel-bounds*
+                                  always (loop for end in *bit-kernel-bounds*
+                                               always (or (> end n) (> start end)
+                                                          (funcall function v start end)))))))
+
+(test bit-count-ranges
+      (check-bit-ranges
+       (lambda (v start end)
+         (and (= (count 1 v :start start :end end) (reference-count 1 v start end))
+              (= (count 0 v :start start :end end) (reference-count 0 v start end))))))
+
+(test bit-position-ranges
+      (check-bit-ranges
+       (lambda (v start end)
+         (loop for bit in '(0 1)
+               always (loop for from-end in '(nil t)
+                            always (eql (position bit v :start start :end end :from-end from-end)
+                                        (reference-position bit v start end from-end)))))))
+
+(test bit-find-ranges
+      (check-bit-ranges
+       (lambda (v start end)
+         (eql (find 1 v :start start :end end :from-end t)
+              (and (reference-position 1 v start end t) 1)))))
+
+;;; A single set (or clear) bit in a long vector goes through the loop
+;;; that skips words without a match.
+(test bit-position-sparse
+      (loop for n in '(31 32 33 65 130 300)
+            always (loop for i below n by 7
+                         always (let ((ones (make-array n :element-type 'bit :initial-element 0))
+                                      (zeros (make-array n :element-type 'bit :initial-element 1)))
+                                  (setf (sbit ones i) 1
+                                        (sbit zeros i) 0)
+                                  (and (eql i (position 1 ones))
+                                       (eql i (position 1 ones :from-end t))
+                                       (eql i (position 0 zeros))
+                                       (eql i (position 0 zeros :from-end t))
+                                       (eql 1 (count 1 ones))
+                                       (eql 1 (count 0 zeros))
+                                       (null (position 1 ones :start (1+ i)))
+                                       (null (position 1 ones :end i)))))))
+
+(test bit-equal-unaligned
+      (loop for n in *bit-kernel-lengths*
+            always (loop for ox in *bit-kernel-offsets*
+                         always (loop for oy in *bit-kernel-offsets*
+                                      for contents = (pattern-bit-vector n 17)
+                                      for x = (displaced-bit-vector contents ox)
+                                      for y = (displaced-bit-vector contents oy)
+                                      always (and (equal x y)
+                                                  (or (zerop n)
+                                                      (let ((i (floor n 2)))
+                                                        (setf (aref y i) (- 1 (aref y i)))
+                                                        (and (not (equal x y))
+                                                             (progn (setf (aref y i) (- 1 (aref y i)))
+                                                                    (equal x y))))))))))
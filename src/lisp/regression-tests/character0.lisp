@@ -106,3 +106,49 @@
 
 (test test-char-17 (char/= #\a #\b #\c #\d))
 (test test-char-18 (let ()(char/= #\a #\b #\c #\d)))
+
+;;; Character properties come from the unicode tables
+(test test-char-19
+      (and (upper-case-p (code-char #xC0))
+           (lower-case-p (code-char #xE0))
+           (char= (char-upcase (code-char #xE0)) (code-char #xC0))
+           (upper-case-p (code-char #x416))
+           (char= (char-downcase (code-char #x416)) (code-char #x436))))
+;;; ÿ upcases outside of base-char, so it has no case
+(test test-char-20 (not (both-case-p (code-char #xFF))))
+(test test-char-21
+      (null
+       (loop for i from 0 below char-code-limit
+             for x = (code-char i)
+             unless (or (not (characterp x))
+                        (not (both-case-p x))
+                        (and (alpha-char-p x)
+                             (char= x (if (upper-case-p x)
+                                          (char-upcase (char-downcase x))
+                                          (char-downcase (char-upcase x))))))
+               collect i)))
+(test test-char-22
+      (and (alpha-char-p (code-char #x5D0))
+           (alphanumericp (code-char #x5D0))
+           (not (alphanumericp (code-char #x660)))
+           (not (graphic-char-p (code-char #x200c)))
+           (graphic-char-p (code-char #x200b))))
+(test test-char-23
+      (and (eq (core:char-general-category #\a) :ll)
+           (eq (core:char-general-category #\A) :lu)
+           (eq (core:char-general-category #\5) :nd)
+           (eq (core:char-general-category #\Space) :zs)))
+(test test-char-24
+      (let ((s (make-string 3 :initial-element (code-char #x3B1))))
+        (and (string= (string-upcase s) (make-string 3 :initial-element (code-char #x391)))
+             (string= (string-upcase "hello world" :start 6) "hello WORLD")
+             (string= (string-downcase (make-array 4 :element-type 'base-char
+                                                    :initial-contents "ABCD"
+                                                    :fill-pointer 2))
+                      "ab"))))
+(test test-char-25
+      (let ((s (copy-seq "abcdef")))
+        (and (eq (nstring-upcase s :start 1 :end 3) s)
+             (string= s "aBCdef"))))
+(test-expect-error test-char-26 (string-upcase "abc" :end 4) :type type-error)
+(test test-char-27 (char= (name-char "latin_small_letter_a") #\a))
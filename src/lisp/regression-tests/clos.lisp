@@ -21,3 +21,140 @@
                 (values
                  (fboundp sym)
                  (let ((x (cons 1 2))) (list (funcall (fdefinition `(setf ,sym)) 3 x) x)))))))
+
+;;; MAKE-INSTANCE with a constant class and keys goes through a cached constructor
+(defclass ctor-test-a ()
+  ((x :initarg :x :initform 'x-default :reader ctor-test-a-x)
+   (y :initarg :y :initarg :yy :initform (list 'y) :reader ctor-test-a-y)
+   (z :reader ctor-test-a-z))
+  (:default-initargs :yy 'yy-default))
+
+(defclass ctor-test-b () ((p :initarg :p :reader ctor-test-b-p)))
+
+(test constructor-slots
+      (let ((a (funcall (compile nil '(lambda () (make-instance 'ctor-test-a :x 1)))))
+            (b (funcall (compile nil '(lambda (v) (make-instance 'ctor-test-a :y v :yy 3))) 2)))
+        (and (eql 1 (ctor-test-a-x a))
+             (eq 'yy-default (ctor-test-a-y a))
+             (not (slot-boundp a 'z))
+             (eq 'x-default (ctor-test-a-x b))
+             (eql 2 (ctor-test-a-y b)))))
+
+(test constructor-invalidated-by-methods
+      (let ((maker (compile nil '(lambda () (make-instance 'ctor-test-b :p 1)))))
+        (and (eql 1 (ctor-test-b-p (funcall maker)))
+             (progn
+               (eval '(defmethod initialize-instance :after ((b ctor-test-b) &key)
+                       (setf (slot-value b 'p) (1+ (slot-value b 'p)))))
+               (eql 2 (ctor-test-b-p (funcall maker)))))))
+
+(test constructor-invalidated-by-redefinition
+      (let ((maker (compile nil '(lambda () (make-instance 'ctor-test-b :p 1)))))
+        (funcall maker)
+        (eval '(defclass ctor-test-b () ((p :initarg :p :reader ctor-test-b-p)
+                                         (q :initform :q :reader ctor-test-b-q))))
+        (eq :q (ctor-test-b-q (funcall maker)))))
+
+(test-expect-error constructor-invalid-initarg
+                   (funcall (compile nil '(lambda () (make-instance 'ctor-test-a :bogus 1))))
+                   :type program-error)
+
+;;; SLOT-VALUE with a constant slot name goes through a call site cache
+(defclass slot-cache-test-a () ((x :initarg :x) (y :initarg :y) (shared :allocation :class)))
+(defclass slot-cache-test-b (slot-cache-test-a) ((z :initarg :z)))
+(defclass slot-cache-test-c () ((u :initform 0) (x :initarg :x) (y :initarg :y)))
+
+(test slot-cache-read-write
+      (let ((reader (compile nil '(lambda (o) (slot-value o 'y))))
+            (writer (compile nil '(lambda (o v) (setf (slot-value o 'y) v))))
+            (a (make-instance 'slot-cache-test-a :x 1 :y 2))
+            (b (make-instance 'slot-cache-test-b :x 3 :y 4 :z 5)))
+        (and (eql 2 (funcall reader a))
+             (eql 2 (funcall reader a))
+             (eql 4 (funcall reader b))
+             (eql 6 (funcall writer a 6))
+             (eql 6 (funcall reader a))
+             (eql 4 (funcall reader b)))))
+
+(test slot-cache-shared-slot
+      (let ((reader (compile nil '(lambda (o) (slot-value o 'shared))))
+            (writer (compile nil '(lambda (o v) (setf (slot-value o 'shared) v)))))
+        (funcall writer (make-instance 'slot-cache-test-a) 7)
+        (and (eql 7 (funcall reader (make-instance 'slot-cache-test-b)))
+             (eql 7 (funcall reader (make-instance 'slot-cache-test-a))))))
+
+(test slot-cache-invalidated-by-redefinition
+      (let ((reader (compile nil '(lambda (o) (slot-value o 'z))))
+            (b (make-instance 'slot-cache-test-b :x 1 :y 2 :z 3)))
+        (funcall reader b)
+        ;; Adding a slot to the superclass moves Z in the subclass.
+        (eval '(defclass slot-cache-test-a () ((w :initform 0) (x :initarg :x) (y :initarg :y)
+                                               (shared :allocation :class))))
+        (eql 4 (funcall reader (make-instance 'slot-cache-test-b :x 1 :y 2 :z 4)))))
+
+(test slot-cache-miss-other-class
+      (let ((reader (compile nil '(lambda (o) (slot-value o 'x))))
+            (a (make-instance 'slot-cache-test-a :x 1))
+            (c (make-instance 'slot-cache-test-c :x 2)))
+        ;; X is at a different location in C, so every call misses.
+        (and (eql 1 (funcall reader a))
+             (eql 2 (funcall reader c))
+             (eql 1 (funcall reader a))
+             (eql 2 (funcall reader c)))))
+
+(test slot-cache-redefined-class
+      (let ((reader (compile nil '(lambda (o) (slot-value o 'y))))
+            (writer (compile nil '(lambda (o v) (setf (slot-value o 'y) v))))
+            (c (make-instance 'slot-cache-test-c :x 1 :y 2)))
+        (funcall writer c 3)
+        (funcall reader c)
+        ;; C is now obsolete and Y has moved; the filled caches must miss.
+        (eval '(defclass slot-cache-test-c () ((y :initarg :y) (v :initform 0) (x :initarg :x))))
+        (and (eql 3 (funcall reader c))
+             (eql 4 (funcall writer c 4))
+             (eql 4 (funcall reader c))
+             (eql 1 (slot-value c 'x)))))
+
+(test-expect-error slot-cache-unbound
+                   (funcall (compile nil '(lambda (o) (slot-value o 'z)))
+                            (make-instance 'slot-cache-test-b))
+                   :type unbound-slot)
+
+(test-expect-error slot-cache-missing
+                   (funcall (compile nil '(lambda (o) (slot-value o 'nonexistent)))
+                            (make-instance 'slot-cache-test-b))
+                   :type error)
+
+;;; Obsolete instances are updated through migration plans
+(defclass migrate-test-a () ((x :initarg :x) (y :initarg :y)))
+(defclass migrate-test-b (migrate-test-a) ((z :initarg :z)))
+
+(defvar *migrate-test-discarded* nil)
+(defmethod update-instance-for-redefined-class :after
+    ((instance migrate-test-a) added discarded plist &rest initargs)
+  (declare (ignore added initargs))
+  (setf *migrate-test-discarded* (list discarded plist)))
+
+(test migrate-slot-value-updates
+      (let ((a (make-instance 'migrate-test-a :x 1 :y 2)))
+        (eval '(defclass migrate-test-a () ((w :initform :w) (y :initarg :y))))
+        (and (eql 2 (slot-value a 'y))
+             (eq :w (slot-value a 'w))
+             (not (slot-exists-p a 'x))
+             (equal '((x) ((x . 1))) *migrate-test-discarded*))))
+
+(test migrate-subclass-updates
+      (let ((b (make-instance 'migrate-test-b :y 2 :z 3)))
+        (eval '(defclass migrate-test-a () ((v :initform :v) (w :initform :w) (y :initarg :y))))
+        (and (eql 3 (slot-value b 'z))
+             (eql 2 (slot-value b 'y))
+             (eq :v (slot-value b 'v)))))
+
+(test migrate-obsolete-instances
+      (let ((instances (loop repeat 10 collect (make-instance 'migrate-test-b :y 1 :z 2))))
+        (eval '(defclass migrate-test-b (migrate-test-a) ((z :initarg :z) (u :initform :u))))
+        (clos:migrate-obsolete-instances)
+        ;; Check the stamps before SLOT-VALUE could update them on first touch
+        (and (notany #'clos::obsolete-instance-p instances)
+             (every (lambda (b) (and (eql 2 (slot-value b 'z)) (eq :u (slot-value b 'u))))
+                    instances))))
@@ -104,4 +104,49 @@
 (test last-ansi-6 (equal '(a b c) (last '(a b c) 4)))
 (test last-ansi-7 (equal (cons 'a 'b) (last '(a . b) 1)))
 (test last-ansi-8 (equal (cons 'a 'b) (last '(a . b) 2)))
-(test ACONS.3 (acons :a :b :c))
\ No newline at end of file
+(test ACONS.3 (acons :a :b :c))
+;;; MAKE-LIST, COPY-LIST and APPEND allocate their conses in chunks and
+;;; keep what a list doesn't use for the next one, so check lengths
+;;; around the size of a chunk (a heap block of conses) too.
+(defparameter *list-chunk-lengths* '(0 1 2 15 16 17 127 128 129 255 256 257 511 512 513 1025))
+
+(defun proper-list-of-length-p (list n)
+  (and (eql (list-length list) n)
+       (null (cdr (last list)))))
+
+(test make-list-chunk-lengths
+      (loop for n in *list-chunk-lengths*
+            always (let ((list (make-list n :initial-element n)))
+                     (and (proper-list-of-length-p list n)
+                          (every (lambda (x) (eql x n)) list)))))
+
+(test copy-list-chunk-lengths
+      (loop for n in *list-chunk-lengths*
+            always (let* ((source (loop for i below n collect i))
+                          (copy (copy-list source)))
+                     (and (equal source copy)
+                          (or (zerop n) (not (eq source copy)))))))
+
+(test copy-list-dotted-chunk-lengths
+      (loop for n in (remove 0 *list-chunk-lengths*)
+            always (let* ((source (append (make-list n :initial-element :x) :tail))
+                          (copy (copy-list source)))
+                     (and (eq :tail (cdr (last copy)))
+                          (eql n (loop for cell on copy count t))))))
+
+(test append-chunk-lengths
+      (loop for n in *list-chunk-lengths*
+            always (let* ((a (make-list n :initial-element :a))
+                          (b (list :b))
+                          (result (append a a b)))
+                     (and (proper-list-of-length-p result (1+ (* 2 n)))
+                          (eq b (last result))
+                          (= n (count :a result :end n))))))
+
+(test append-short-lists-interleaved
+      ;; Many short lists in a row come out of the same chunk
+      (let ((lists (loop for i below 1000
+                         collect (append (list i) (list (- i))))))
+        (loop for list in lists
+              for i from 0
+              always (equal list (list i (- i))))))
@@ -26,3 +26,72 @@
         (and (BOUNDP 'X) (not (BOUNDP 'Y)) (not (BOUNDP 'Z)) (not (BOUNDP 'W)))))
 
 
+
+;;; APPLY spreads arguments beyond call-arguments-limit on the stack
+(test apply-many-arguments
+      (let ((args (make-list (* 4 call-arguments-limit) :initial-element 1)))
+        (and (= (apply #'+ args) (* 4 call-arguments-limit))
+             (= (apply (lambda (core:&va-rest r) (core:vaslist-length r)) 1 2 args)
+                (+ 2 (* 4 call-arguments-limit))))))
+
+;;; The other paths that call with more arguments than the generated
+;;; arity cases: FUNCALL and MULTIPLE-VALUE-CALL in compiled code, the
+;;; fast_apply entry points, CORE:APPLY-OLD and the invocation history
+(test funcall-many-arguments-compiled
+      (let ((n (* 2 call-arguments-limit)))
+        (= n (funcall (compile nil `(lambda (f) (funcall f ,@(make-list n :initial-element 1))))
+                      #'+))))
+
+(test multiple-value-call-many-values
+      (let ((n (floor call-arguments-limit 2)))
+        (= (* 3 n)
+           (funcall (compile nil '(lambda (f values)
+                                   (multiple-value-call f
+                                     (values-list values) (values-list values) (values-list values))))
+                    #'+ (make-list n :initial-element 1)))))
+
+(test fast-apply-many-arguments
+      (let ((args (make-list (* 2 call-arguments-limit) :initial-element 1)))
+        (and (= (+ 3 (length args))
+                (funcall (compile nil '(lambda (f a b rest)
+                                        (core:multiple-value-foreign-call "fast_apply3" f a b rest)))
+                         #'+ 1 2 args))
+             (= (+ 3 (length args))
+                (funcall (compile nil '(lambda (f args)
+                                        (core:multiple-value-foreign-call "fast_apply_general" f args)))
+                         #'+ (list 1 2 args))))))
+
+(test apply-old-many-arguments
+      (let ((args (make-list (* 2 call-arguments-limit) :initial-element 1)))
+        (= (+ 1 (length args)) (core:apply-old #'+ 1 args))))
+
+(test ihs-arguments-many-arguments
+      (let ((f (core:interpret-eval-with-env
+                '#'(lambda (&rest r)
+                     (declare (ignore r))
+                     (core:ihs-arguments (core:ihs-top)))
+                nil))
+            (args (loop for i below (* 2 call-arguments-limit) collect i)))
+        (equalp (coerce args 'vector) (apply f args))))
+
+(defun lookup-address-line (function)
+  (multiple-value-bind (symbol start end type file line)
+      (core:lookup-address (core:function-pointer function))
+    (declare (ignore start end type))
+    (and symbol file line)))
+
+(test lookup-address-compile-file-function
+      (let ((line (lookup-address-line #'lookup-address-line)))
+        (and (integerp line) (plusp line))))
+
+(test lookup-address-compiled-function
+      (let ((line (lookup-address-line (compile nil '(lambda (x) (1+ x))))))
+        (and (integerp line) (plusp line))))
+
+(test backtrace-frame-source-position
+      (core:call-with-backtrace
+       (lambda (frames)
+         (some (lambda (frame)
+                 (let ((position (core:backtrace-frame-source-position frame)))
+                   (and position (integerp (second position)) (plusp (second position)))))
+               frames))))
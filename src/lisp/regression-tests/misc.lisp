@@ -176,3 +176,48 @@
 (test-expect-error special-operator-p-2 (funcall 'go 23) :type undefined-function)
 
                  
+
+;;; An interrupt reaches a thread spinning in a loop that never allocates
+;;; through the safepoint poll at the loop's back edge.
+(defvar *safepoint-delivered* nil)
+
+(defun safepoint-spin ()
+  (let ((x 0))
+    (declare (fixnum x))
+    (loop (setq x (logand (1+ x) #xffff)))))
+
+#+threads
+(test safepoint-interrupt-non-consing-loop
+      (progn
+        (setq *safepoint-delivered* nil)
+        (let ((process (mp:process-run-function 'safepoint-spinner
+                                                 (lambda () (catch 'stop (safepoint-spin))))))
+          (sleep 0.05)
+          (mp:interrupt-process process (lambda ()
+                                          (setq *safepoint-delivered* t)
+                                          (throw 'stop nil)))
+          (loop repeat 500
+                until *safepoint-delivered*
+                do (sleep 0.01))
+          ;; Only join a thread that stopped spinning
+          (and *safepoint-delivered*
+               (progn (mp:process-join process) t)))))
+
+;;; Resetting the sampling profiler frees the sample buffer - signals
+;;; that are still being handled must not write into it afterwards.
+(defun sampling-profiler-spin (n)
+  (let ((x 0))
+    (declare (fixnum x))
+    (dotimes (i n x)
+      (setq x (logand (+ x i) #xffff)))))
+
+(test sampling-profiler-start-stop-reset
+      (progn
+        (dotimes (round 20)
+          (core:sampling-profiler-start :frequency 1000 :max-samples 8)
+          (sampling-profiler-spin 200000)
+          (core:sampling-profiler-stop)
+          (core:sampling-profiler-reset))
+        (multiple-value-bind (running-p samples dropped)
+            (core:sampling-profiler-info)
+          (and (null running-p) (zerop samples) (zerop dropped)))))
@@ -399,3 +399,77 @@
 (test-expect-error find-2a
                    (locally (declare (notinline find))
                      (find 5 '(1 2 3 . 4))) :type type-error)
+
+(test read-sequence-string-input-stream
+      (let ((buffer (make-string 6 :initial-element #\-)))
+        (with-input-from-string (in "abcd")
+          (and (= 5 (read-sequence buffer in :start 1))
+               (string= buffer "abcd--")
+               (null (read-char in nil nil))))))
+
+(test write-sequence-string-output-column
+      (with-output-to-string (out)
+        (write-sequence (format nil "ab~%cde") out)
+        (= 3 (sys:file-column out))))
+
+(defmacro with-temporary-file ((var name) &body body)
+  "Bind VAR to a file NAME in a fresh directory under /tmp, removing both afterwards."
+  (let ((directory (gensym "DIRECTORY")))
+    `(let* ((,directory (core:mkdtemp "/tmp/clasp-sequences-"))
+            (,var (merge-pathnames ,name ,directory)))
+       (unwind-protect (progn ,@body)
+         (when (probe-file ,var) (delete-file ,var))
+         (core:rmdir ,directory)))))
+
+(test read-write-sequence-octets
+      (let ((data (make-array 300 :element-type '(unsigned-byte 8)))
+            (back (make-array 300 :element-type '(unsigned-byte 8) :initial-element 0)))
+        (dotimes (i 300) (setf (aref data i) (mod i 256)))
+        (with-temporary-file (file "read-write-sequence-octets.dat")
+          (with-open-file (out file :direction :output
+                                    :if-exists :supersede
+                                    :element-type '(unsigned-byte 8))
+            (write-sequence data out))
+          (with-open-file (in file :element-type '(unsigned-byte 8))
+            (and (= 300 (read-sequence back in))
+                 (equalp data back))))))
+
+(test read-write-sequence-latin-1
+      (let ((back (make-string 8 :element-type 'base-char :initial-element #\-)))
+        (with-temporary-file (file "read-write-sequence-latin-1.txt")
+          (with-open-file (out file :direction :output
+                                    :if-exists :supersede
+                                    :external-format :latin-1)
+            (write-sequence (coerce (format nil "ab~%cd") 'base-string) out))
+          (with-open-file (in file :external-format :latin-1)
+            (and (= 5 (read-sequence back in))
+                 (string= back (format nil "ab~%cd---"))
+                 (progn (unread-char #\d in) (char= #\d (read-char in))))))))
+
+;;; Long enough to take the hashed paths
+(test remove-duplicates-hashed-list
+      (let ((l (loop for i below 200 collect (mod i 50))))
+        (and (equal (remove-duplicates l) (loop for i from 150 below 200 collect (mod i 50)))
+             (equal (remove-duplicates l :from-end t) (loop for i below 50 collect i))
+             (equal (remove-duplicates (copy-list l) :start 10 :end 190)
+                    (append (subseq l 0 10) (loop for i from 140 below 190 collect (mod i 50)) (subseq l 190))))))
+
+(test delete-duplicates-hashed-list
+      (let ((l (loop for i below 200 collect (list (mod i 50)))))
+        (equal (delete-duplicates (copy-list l) :test #'equal :from-end t)
+               (loop for i below 50 collect (list i)))))
+
+(test remove-duplicates-hashed-vector
+      (let ((v (coerce (loop for i below 200 collect (format nil "~a" (mod i 50))) 'vector)))
+        (and (= 50 (length (remove-duplicates v :test #'equal)))
+             (equalp (remove-duplicates v :test 'equal :from-end t)
+                     (subseq v 0 50))
+             (= 200 (length (remove-duplicates v))))))
+
+(test set-functions-hashed
+      (let ((a (loop for i below 100 collect i))
+            (b (loop for i from 50 below 150 collect i)))
+        (and (equal (intersection a b) (loop for i from 50 below 100 collect i))
+             (equal (set-difference a b) (loop for i below 50 collect i))
+             (equal (union a b) (append (loop for i below 50 collect i) b))
+             (equal (set-difference a b :key #'- :test #'eql) (loop for i below 50 collect i)))))
@@ -130,3 +130,58 @@
                 (file-string-length last-stream "jd")))))))
 
 
+
+;;; String output streams grow by chunks
+(test string-output-stream-chunks
+      (let ((s (make-string-output-stream))
+            (expected (make-string 100000)))
+        (dotimes (i 100000)
+          (let ((c (code-char (+ 97 (mod i 26)))))
+            (setf (char expected i) c)
+            (if (zerop (mod i 7))
+                (write-string (string c) s)
+                (write-char c s))))
+        (and (= (file-position s) 100000)
+             (string= (get-output-stream-string s) expected)
+             (string= (get-output-stream-string s) ""))))
+
+(test string-output-stream-widens
+      (let* ((wide (code-char #x3bb))
+             (result (with-output-to-string (s)
+                       (dotimes (i 300) (write-char #\a s))
+                       (write-char wide s)
+                       (write-string (make-string 3 :initial-element wide) s))))
+        (and (= (length result) 304)
+             (char= (char result 299) #\a)
+             (char= (char result 300) wide)
+             (char= (char result 303) wide)
+             (subtypep (array-element-type result) 'character))))
+
+(test string-output-stream-element-type
+      (and (subtypep (stream-element-type (make-string-output-stream :element-type 'base-char))
+                     'base-char)
+           (subtypep 'character
+                     (stream-element-type (make-string-output-stream)))
+           (subtypep (array-element-type
+                      (let ((s (make-string-output-stream :element-type 'base-char)))
+                        (write-string "abc" s)
+                        (get-output-stream-string s)))
+                     'base-char)))
+
+(test string-output-stream-file-position
+      (let ((s (make-string-output-stream)))
+        (dotimes (i 1000) (write-char #\x s))
+        (file-position s 10)
+        (write-string "yz" s)
+        (string= (get-output-stream-string s)
+                 (concatenate 'string (make-string 10 :initial-element #\x) "yz"))))
+
+(test write-output-stream-string
+      (let ((s (make-string-output-stream))
+            (text (make-string 50000 :initial-element #\q)))
+        (write-string text s)
+        (write-string "end" s)
+        (and (string= (with-output-to-string (out)
+                        (core:write-output-stream-string s out))
+                      (concatenate 'string text "end"))
+             (string= (get-output-stream-string s) ""))))
@@ -905,3 +905,20 @@
                    (APPLY 'STRING-NOT-GREATERP '("abbt" "ABBS" :START2 -5)))
 (TEST-EXPECT-ERROR TEST-STRING-COMPARISONL-447
                    (APPLY 'STRING-NOT-GREATERP '("abbt" "ABBS" :START2 10)))
+
+;;; The case insensitive comparisons fold characters beyond ASCII
+(TEST TEST-STRING-COMPARISONL-448
+      (EQUALP 1 (STRING-LESSP (CONCATENATE 'STRING (LIST (CODE-CHAR #x436) #\a))
+                              (CONCATENATE 'STRING (LIST (CODE-CHAR #x416) #\B)))))
+(TEST TEST-STRING-COMPARISONL-449
+      (EQUALP NIL (STRING-LESSP (STRING (CODE-CHAR #xE0)) (STRING (CODE-CHAR #xC0)))))
+(TEST TEST-STRING-COMPARISONL-450
+      (EQUALP NIL (STRING-NOT-EQUAL (CONCATENATE 'STRING (LIST (CODE-CHAR #xE0) (CODE-CHAR #x436)))
+                                    (CONCATENATE 'STRING (LIST (CODE-CHAR #xC0) (CODE-CHAR #x416))))))
+(TEST TEST-STRING-COMPARISONL-451
+      (EQUALP 1 (STRING-GREATERP (CONCATENATE 'STRING (LIST (CODE-CHAR #x416) #\z))
+                                 (CONCATENATE 'STRING (LIST (CODE-CHAR #x436) #\Y)))))
+(TEST TEST-STRING-COMPARISONL-452
+      (EQUALP 1 (STRING-NOT-GREATERP (STRING (CODE-CHAR #xE0)) (STRING (CODE-CHAR #xC0)))))
+(TEST TEST-STRING-COMPARISONL-453
+      (EQUALP 1 (STRING-NOT-LESSP (STRING (CODE-CHAR #x436)) (STRING (CODE-CHAR #x416)))))
@@ -108,3 +108,34 @@
 ;;; These should not return t, but the first index, where it is different
 (test eql-1 (eql 0 (string/= "a" "b")))
 (test eql-2 (eql 0 (string-not-equal "a" "b")))
+
+;;; memchr/memmem and word at a time string kernels
+(test string-kernels-search
+      (let ((base (coerce "the quick brown fox jumps over the lazy dog" 'base-string))
+            (wide (concatenate 'string "the quick " (string (code-char 955)) " fox")))
+        (and (= 16 (search "fox" base))
+             (= 31 (search "the" base :start2 1))
+             (null (search "cat" base))
+             (= 0 (search "" base))
+             (= 10 (search (string (code-char 955)) wide))
+             (null (search (string (code-char 955)) base))
+             (= 16 (search "FOX" base :test #'char-equal))
+             (= 4 (search "Quick" wide :test 'char-equal)))))
+
+(test string-kernels-position
+      (let ((s (coerce "abcabcabc" 'base-string)))
+        (and (= 2 (position #\c s))
+             (= 8 (position #\c s :from-end t))
+             (= 5 (position #\c s :start 3 :end 6))
+             (null (position #\z s))
+             (null (position (code-char 955) s))
+             (eql #\b (find #\b s))
+             (= 1 (position (code-char 955) (concatenate 'string "a" (string (code-char 955))))))))
+
+(test string-kernels-equal
+      (and (string= "abcdefghijklmnopq" (copy-seq "abcdefghijklmnopq"))
+           (not (string= "abcdefghijklmnopq" "abcdefghijklmnopz"))
+           (string-equal "ABCDEFGHIJKLMNOPQ" "abcdefghijklmnopq")
+           (not (string-equal "ABCDEFGHIJKLMNOPQ" "abcdefghijklmnopz"))
+           (string= "abc" (concatenate 'string "abc"))
+           (not (string= "abc" "abcd"))))
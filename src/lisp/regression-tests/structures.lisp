@@ -68,3 +68,64 @@
 
 (setf (find-class 'otto3) nil)
 
+
+;;; Slots with numeric types are kept unboxed
+(defstruct raw-point
+  (x 0d0 :type double-float)
+  (name 'origin)
+  (count 0 :type fixnum)
+  (y 0d0 :type double-float)
+  (flags 0 :type (unsigned-byte 8))
+  (weight :type single-float))
+
+(defstruct (raw-point3 (:include raw-point (count 1 :type fixnum)))
+  (z 0d0 :type double-float)
+  (id 0 :type (signed-byte 32)))
+
+(test structure-raw-slots
+      (let ((p (make-raw-point :x 1.5d0 :y 2.5d0 :flags 255)))
+        (setf (raw-point-count p) 42)
+        (and (eql 1.5d0 (raw-point-x p))
+             (eql 2.5d0 (raw-point-y p))
+             (eql 42 (raw-point-count p))
+             (eql 255 (raw-point-flags p))
+             (eql 0f0 (raw-point-weight p))
+             (eq 'origin (raw-point-name p)))))
+
+(test structure-raw-slots-include
+      (let ((p (make-raw-point3 :x 1d0 :z 3d0 :id -7)))
+        (and (eql 1 (raw-point-count p))
+             (eql 1d0 (raw-point-x p))
+             (eql 3d0 (raw-point3-z p))
+             (eql -7 (raw-point3-id p))
+             (raw-point-p p))))
+
+(test structure-raw-slots-copy
+      (let* ((p (make-raw-point :x 1d0))
+             (copy (copy-raw-point p)))
+        (setf (raw-point-x copy) 2d0)
+        (and (eql 1d0 (raw-point-x p))
+             (eql 2d0 (raw-point-x copy))
+             (equalp p (make-raw-point :x 1d0)))))
+
+(test structure-raw-slots-slot-value
+      (let ((p (make-raw-point :y 4d0)))
+        (setf (slot-value p 'count) 9)
+        (and (eql 4d0 (slot-value p 'y))
+             (eql 9 (raw-point-count p)))))
+
+(test structure-raw-slots-print
+      (equal "#S(RAW-POINT :NAME ORIGIN :X 1.0d0 :COUNT 0 :Y 0.0d0 :FLAGS 0 :WEIGHT 0.0)"
+             (let ((*package* (symbol-package 'raw-point)))
+               (prin1-to-string (make-raw-point :x 1d0)))))
+
+(test structure-raw-slots-stored-raw
+      (let ((layout (si::structure-raw-layout 'raw-point3)))
+        (and (every (lambda (slot) (assoc slot layout)) '(x count y flags weight z id))
+             (not (assoc 'name layout))
+             (not (member 'flags (si::structure-rack-slots 'raw-point)))
+             (not (member 'id (si::structure-rack-slots 'raw-point3))))))
+
+(test-expect-error structure-raw-slots-type
+                   (setf (raw-point-x (make-raw-point)) 'not-a-float)
+                   :type type-error)
@@ -0,0 +1,9 @@
+;;;; Shared by the benchmark scripts in this directory, which start with
+;;;;   (load "sys:tests;benchmark.lsp")
+
+(defmacro time-run (name reps form)
+  "Evaluate FORM REPS times and print the average real time it took."
+  `(let ((start (get-internal-real-time)))
+     (dotimes (i ,reps) ,form)
+     (format t "~30a ~8,4f seconds/op~%" ,name
+             (float (/ (- (get-internal-real-time) start) internal-time-units-per-second ,reps)))))
@@ -0,0 +1,29 @@
+;;;; Time APPLY spreading lists of 10, 100 and 10000 arguments.
+;;;; Arguments beyond call-arguments-limit are passed on the stack.
+
+(load "sys:tests;benchmark.lsp")
+
+(defun count-args (&rest args)
+  (length args))
+
+(defun count-va-args (core:&va-rest args)
+  (core:vaslist-length args))
+
+(defparameter *args-10* (make-list 10 :initial-element 1))
+(defparameter *args-100* (make-list 100 :initial-element 1))
+(defparameter *args-10000* (make-list 10000 :initial-element 1))
+
+(assert (= (apply #'count-va-args *args-10000*) 10000))
+(assert (= (apply #'count-va-args 1 2 *args-10000*) 10002))
+
+(defun do-apply-10 (n) (dotimes (i n) (apply #'count-va-args *args-10*)))
+(time-run "10^6 apply 10" 1 (do-apply-10 1000000))
+
+(defun do-apply-100 (n) (dotimes (i n) (apply #'count-va-args *args-100*)))
+(time-run "10^5 apply 100" 1 (do-apply-100 100000))
+
+(defun do-apply-10000 (n) (dotimes (i n) (apply #'count-va-args *args-10000*)))
+(time-run "10^3 apply 10000" 1 (do-apply-10000 1000))
+
+(defun do-apply-rest-10000 (n) (dotimes (i n) (apply #'count-args *args-10000*)))
+(time-run "10^3 apply &rest 10000" 1 (do-apply-rest-10000 1000))
@@ -0,0 +1,22 @@
+;;;; Time the bit vector kernels on 10^8 bit vectors.
+
+(defparameter *bits* 100000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defparameter *x* (make-array *bits* :element-type 'bit :initial-element 0))
+(defparameter *y* (make-array *bits* :element-type 'bit :initial-element 1))
+(defparameter *r* (make-array *bits* :element-type 'bit))
+(setf (sbit *x* (1- *bits*)) 1)
+(defparameter *dx* (make-array (- *bits* 64) :element-type 'bit :displaced-to *x* :displaced-index-offset 3))
+(defparameter *dy* (make-array (- *bits* 64) :element-type 'bit :displaced-to *y* :displaced-index-offset 17))
+
+(time-run "bit-and aligned" 10 (bit-and *x* *y* *r*))
+(time-run "bit-xor aligned" 10 (bit-xor *x* *y* *r*))
+(time-run "bit-ior unaligned" 10 (bit-ior *dx* *dy*))
+(time-run "count 1" 10 (count 1 *x*))
+(time-run "count 0" 10 (count 0 *y*))
+(time-run "position 1" 10 (position 1 *x*))
+(time-run "position 1 :from-end" 10 (position 1 *y* :from-end t))
+(time-run "find 0" 10 (find 0 *y*))
+(time-run "equal" 10 (equal *x* (copy-seq *x*)))
@@ -0,0 +1,27 @@
+;;;; Take a heap census before and after building a live set of instances
+;;;; and print the biggest changes along with the time each census took.
+
+(defclass census-node ()
+  ((value :initarg :value)
+   (next :initarg :next)))
+
+(defun take-census ()
+  (let ((start (get-internal-real-time)))
+    (multiple-value-bind (census objects bytes)
+        (gctools:heap-census)
+      (format t "census of ~d objects ~d bytes took ~6,4f seconds~%" objects bytes
+              (float (/ (- (get-internal-real-time) start) internal-time-units-per-second)))
+      census)))
+
+(defparameter *before* (take-census))
+
+(defparameter *nodes* (let (head)
+                        (dotimes (i 200000 head)
+                          (setf head (make-instance 'census-node :value (list i) :next head)))))
+
+(defparameter *after* (take-census))
+
+(loop for (key count bytes) in (gctools:heap-census-diff *before* *after*)
+      repeat 10
+      do (format t "~40a ~10d objects ~12d bytes~%"
+                 (if (typep key 'class) (class-name key) key) count bytes))
@@ -0,0 +1,29 @@
+;;;; Time the character predicates and the STRING-UPCASE/DOWNCASE kernels
+;;;; on ASCII and non-ASCII text.
+
+(defparameter *size* 4000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defun text (alphabet element-type)
+  (let ((s (make-string *size* :element-type element-type)))
+    (dotimes (i *size* s)
+      (setf (char s i) (char alphabet (mod i (length alphabet)))))))
+
+(defparameter *ascii* (text "The quick brown fox jumps over the lazy dog. " 'base-char))
+(defparameter *latin* (text (map 'string #'code-char '(#xE9 #xC0 #x20 #x61 #xFC #xDF)) 'base-char))
+(defparameter *cyrillic* (text (map 'string #'code-char '(#x416 #x438 #x432 #x20 #x3B1 #x3A9)) 'character))
+
+(defun count-property (predicate string)
+  (count-if predicate string))
+
+(time-run "upper-case-p ascii" 5 (count-property #'upper-case-p *ascii*))
+(time-run "upper-case-p cyrillic" 5 (count-property #'upper-case-p *cyrillic*))
+(time-run "alpha-char-p cyrillic" 5 (count-property #'alpha-char-p *cyrillic*))
+(time-run "graphic-char-p cyrillic" 5 (count-property #'graphic-char-p *cyrillic*))
+(time-run "string-upcase ascii" 10 (string-upcase *ascii*))
+(time-run "string-upcase latin-1" 10 (string-upcase *latin*))
+(time-run "string-upcase cyrillic" 10 (string-upcase *cyrillic*))
+(time-run "string-downcase cyrillic" 10 (string-downcase *cyrillic*))
+(time-run "nstring-upcase ascii" 10 (nstring-upcase *ascii*))
+(time-run "name-char" 100000 (name-char "Latin_Small_Letter_Z"))
@@ -0,0 +1,19 @@
+;;;; Time REMOVE-DUPLICATES and the set functions on 100k element inputs.
+
+(defparameter *n* 100000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defparameter *list* (loop for i below *n* collect (random (floor *n* 2))))
+(defparameter *strings* (mapcar #'princ-to-string *list*))
+(defparameter *vector* (coerce *list* 'vector))
+(defparameter *other* (loop for i below *n* collect (random *n*)))
+
+(time-run "remove-duplicates list" 5 (remove-duplicates *list*))
+(time-run "remove-duplicates :from-end" 5 (remove-duplicates *list* :from-end t))
+(time-run "remove-duplicates equal" 5 (remove-duplicates *strings* :test #'equal))
+(time-run "remove-duplicates vector" 5 (remove-duplicates *vector*))
+(time-run "delete-duplicates list" 5 (delete-duplicates (copy-list *list*)))
+(time-run "union" 5 (union *list* *other*))
+(time-run "intersection" 5 (intersection *list* *other*))
+(time-run "set-difference" 5 (set-difference *list* *other*))
@@ -0,0 +1,35 @@
+;;;; Build a synthetic deep tree of small files and time DIRECTORY over it
+;;;; with **, with one and with several reader threads and with the
+;;;; listing cache enabled.
+
+(defparameter *root* (merge-pathnames "tdirectory-tree/" (core:mkdtemp "/tmp/clasp-")))
+
+(defun build-tree (dir depth width files)
+  (dotimes (i files)
+    (with-open-file (stream (merge-pathnames (format nil "file~d.lisp" i) dir)
+                            :direction :output :if-does-not-exist :create :if-exists :supersede)
+      (write-line ";" stream))
+    (with-open-file (stream (merge-pathnames (format nil "file~d.fasl" i) dir)
+                            :direction :output :if-does-not-exist :create :if-exists :supersede)
+      (write-line ";" stream)))
+  (when (> depth 0)
+    (dotimes (i width)
+      (let ((sub (merge-pathnames (format nil "dir~d/" i) dir)))
+        (ensure-directories-exist sub)
+        (build-tree sub (1- depth) width files)))))
+
+(ensure-directories-exist *root*)
+(build-tree *root* 5 5 8)
+
+(load "sys:tests;benchmark.lsp")
+
+(let ((mask (merge-pathnames "**/*.lisp" *root*)))
+  (format t "~d entries~%" (length (directory mask)))
+  (core:set-directory-walk-threads 1)
+  (time-run "one thread" 5 (directory mask))
+  (core:set-directory-walk-threads 0)
+  (time-run "thread per core" 5 (directory mask))
+  (core:directory-listing-cache t)
+  (time-run "cache cold" 1 (directory mask))
+  (time-run "cache warm" 5 (directory mask))
+  (core:directory-listing-cache nil))
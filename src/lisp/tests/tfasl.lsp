@@ -0,0 +1,39 @@
+;;;; Time COMPILE-FILE + LOAD over a few hundred small files with fasls
+;;;; linked by the external linker and linked in process, then time LOAD
+;;;; alone - an in process fasl is an object file that LOAD only relocates.
+
+(defparameter *dir* (core:mkdtemp "/tmp/clasp-tfasl-"))
+(defparameter *count* 300)
+
+(defun source-file (i)
+  (merge-pathnames (format nil "small~d.lisp" i) *dir*))
+
+(dotimes (i *count*)
+  (with-open-file (stream (source-file i) :direction :output :if-exists :supersede)
+    (format stream "(defun small-~d (x) (+ x ~d))~%(defparameter *small-~d* (small-~d 1))~%" i i i i)))
+
+(defun elapsed (start)
+  (float (/ (- (get-internal-real-time) start) internal-time-units-per-second)))
+
+(defun compile-and-load-all ()
+  (let ((start (get-internal-real-time))
+        (fasls nil))
+    (dotimes (i *count*)
+      (let ((fasl (compile-file (source-file i) :verbose nil :print nil)))
+        (load fasl)
+        (push fasl fasls)))
+    (values (elapsed start) fasls)))
+
+(defun load-all (fasls)
+  (let ((start (get-internal-real-time)))
+    (dolist (fasl fasls) (load fasl))
+    (elapsed start)))
+
+(dolist (in-process '(nil t))
+  (let ((cmp::*link-fasls-in-process* in-process))
+    (multiple-value-bind (seconds fasls)
+        (compile-and-load-all)
+      (format t "~a compile-file + load: ~6,3f seconds for ~d files~%"
+              (if in-process "in process:     " "external linker:") seconds *count*)
+      (format t "~a load:                ~6,3f seconds for ~d files~%"
+              (if in-process "in process:     " "external linker:") (load-all fasls) *count*))))
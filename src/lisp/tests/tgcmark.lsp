@@ -0,0 +1,35 @@
+;;;; Compare Boehm collection pauses and retained heap on a large CLOS object graph.
+;;;; Run once as is and once with CLASP_BOEHM_PRECISE=1 in the environment.
+
+(format t "precise marking: ~a~%" (gctools:boehm-precise-marking-p))
+
+(defclass node ()
+  ((id :initarg :id)
+   (weight :initarg :weight)
+   (children :initform nil :accessor children)
+   (payload :initform (make-array 16 :initial-element 0))))
+
+(defun build-graph (n)
+  (let ((nodes (make-array n)))
+    (dotimes (i n)
+      (setf (aref nodes i) (make-instance 'node :id i :weight (* i 4))))
+    (dotimes (i n)
+      (push (aref nodes (random n)) (children (aref nodes i)))
+      (push (aref nodes (random n)) (children (aref nodes i))))
+    nodes))
+
+(defun time-collection (label)
+  (let ((start (get-internal-real-time)))
+    (gctools:garbage-collect)
+    (multiple-value-bind (heap free)
+        (gctools:heap-bytes)
+      (format t "~6,4f seconds  heap ~12d  free ~12d  ~a~%"
+              (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))
+              heap free label))))
+
+(defparameter *graph* (build-graph 1000000))
+(time-collection "live graph")
+(time-collection "live graph again")
+(setf *graph* nil)
+(time-collection "graph dropped")
+(time-collection "graph dropped again")
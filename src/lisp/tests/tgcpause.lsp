@@ -0,0 +1,28 @@
+;;;; Print the GC pause histogram for an allocation-heavy workload that keeps
+;;;; a large live set. Compare a normal run with one started with
+;;;; CLASP_BOEHM_INCREMENTAL=1 (and optionally CLASP_BOEHM_PAUSE_TARGET_MS=5).
+
+(format t "incremental: ~a~%" (gctools:boehm-incremental-p))
+
+(defparameter *live* (make-array 2000000))
+(dotimes (i (length *live*))
+  (setf (aref *live* i) (list i (* 2 i))))
+
+(defun churn (n)
+  (let ((keep nil))
+    (dotimes (i n)
+      (setf keep (make-list 8 :initial-element i))
+      (when (zerop (mod i 1000))
+        (setf (aref *live* (random (length *live*))) keep)))))
+
+(gctools:gc-pause-histogram-reset)
+(let ((start (get-internal-real-time)))
+  (churn 20000000)
+  (format t "~6,4f seconds of mutator time~%"
+          (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+
+(multiple-value-bind (histogram pauses total max collections)
+    (gctools:gc-pause-histogram)
+  (format t "~d collections ~d pauses total ~d us max ~d us~%" collections pauses total max)
+  (loop for (bound . count) in histogram
+        do (format t "  < ~10d us ~8d~%" bound count)))
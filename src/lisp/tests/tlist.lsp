@@ -0,0 +1,19 @@
+;;;; Measure list construction throughput of the primitives that
+;;;; allocate their conses in batches, for short lists as well as long
+;;;; ones - each length builds the same total number of conses.
+
+(defparameter *total-conses* 10000000)
+
+(defmacro time-list-op (name len form)
+  `(let ((reps (floor *total-conses* ,len))
+         (start (get-internal-real-time)))
+     (dotimes (i reps) ,form)
+     (let ((secs (float (/ (- (get-internal-real-time) start) internal-time-units-per-second))))
+       (format t "~12a ~6d ~8,4f seconds ~12,1f conses/second~%" ,name ,len secs
+               (if (zerop secs) 0.0 (/ (* reps ,len) secs))))))
+
+(dolist (len '(1 2 4 8 16 1000))
+  (let ((source (make-list len :initial-element :x)))
+    (time-list-op "make-list" len (make-list len :initial-element i))
+    (time-list-op "copy-list" len (copy-list source))
+    (time-list-op "append" len (append source nil))))
@@ -0,0 +1,29 @@
+;;;; Time MAKE-INSTANCE through the cached constructors against the full protocol.
+
+(defparameter *n* 1000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defclass point ()
+  ((x :initarg :x :initform 0)
+   (y :initarg :y :initform 0)
+   (z :initarg :z :initform 0)))
+
+(defclass tagged-point (point)
+  ((tag :initarg :tag)))
+
+(defmethod initialize-instance :after ((p tagged-point) &key)
+  (unless (slot-boundp p 'tag) (setf (slot-value p 'tag) :none)))
+
+(defun make-points-constant (n)
+  (dotimes (i n) (make-instance 'point :x i :y i)))
+
+(defun make-points-variable (n class)
+  (dotimes (i n) (make-instance class :x i :y i)))
+
+(defun make-tagged-points (n)
+  (dotimes (i n) (make-instance 'tagged-point :x i :y i)))
+
+(time-run "constant class and keys" 3 (make-points-constant *n*))
+(time-run "variable class" 3 (make-points-variable *n* 'point))
+(time-run ":after initialize-instance" 3 (make-tagged-points *n*))
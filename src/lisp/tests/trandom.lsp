@@ -0,0 +1,33 @@
+;;;; Time RANDOM against the xoshiro256 generator and the bulk fill functions.
+
+(defparameter *n* 10000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defparameter *mt* (make-random-state t))
+(defparameter *xo* (core:make-random-state-with-generator :xoshiro256 12345))
+(defparameter *doubles* (make-array *n* :element-type 'double-float))
+(defparameter *fixnums* (make-array *n* :element-type 'fixnum))
+
+(defun random-loop (limit state)
+  (dotimes (i *n*) (setf (aref *doubles* i) (random limit state))))
+
+(defun random-int-loop (limit state)
+  (dotimes (i *n*) (setf (aref *fixnums* i) (random limit state))))
+
+(time-run "random 1d0 mt19937" 3 (random-loop 1d0 *mt*))
+(time-run "random 1d0 xoshiro256" 3 (random-loop 1d0 *xo*))
+(time-run "random 1000 mt19937" 3 (random-int-loop 1000 *mt*))
+(time-run "random 1000 xoshiro256" 3 (random-int-loop 1000 *xo*))
+(time-run "random-fill 1d0 mt19937" 3 (core:random-fill *doubles* 1d0 *mt*))
+(time-run "random-fill 1d0 xoshiro256" 3 (core:random-fill *doubles* 1d0 *xo*))
+(time-run "random-fill 1000 xoshiro256" 3 (core:random-fill *fixnums* 1000 *xo*))
+(time-run "random-fill-normal xoshiro256" 3 (core:random-fill-normal *doubles* 0d0 1d0 *xo*))
+
+;;; Per thread streams from one seed are reproducible
+(let* ((a (core:make-random-state-with-generator :xoshiro256 42))
+       (b (core:make-random-state-with-generator :xoshiro256 42))
+       (sa (core:random-state-split a))
+       (sb (core:random-state-split b)))
+  (assert (= (random 1000000 sa) (random 1000000 sb)))
+  (assert (= (random 1000000 a) (random 1000000 b))))
@@ -0,0 +1,36 @@
+;;;; Time updating instances after a class redefinition, on first touch and by a heap walk.
+
+(defparameter *n* 100000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defclass node ()
+  ((a :initarg :a :accessor node-a)
+   (b :initarg :b :accessor node-b)))
+
+(defun redefine-node (extra)
+  (eval `(defclass node ()
+           ((,extra :initform 0)
+            (a :initarg :a :accessor node-a)
+            (b :initarg :b :accessor node-b)))))
+
+(defun make-nodes ()
+  (let ((nodes (make-array *n*)))
+    (dotimes (i *n* nodes) (setf (svref nodes i) (make-instance 'node :a i :b i)))))
+
+(defun touch-nodes (nodes)
+  (let ((sum 0))
+    (dotimes (i (length nodes) sum) (incf sum (node-a (svref nodes i))))))
+
+(defparameter *nodes* (make-nodes))
+
+(redefine-node (gensym "EXTRA"))
+(time-run "update on first touch" 1 (touch-nodes *nodes*))
+(time-run "touch after update" 1 (touch-nodes *nodes*))
+
+(redefine-node (gensym "EXTRA"))
+(time-run "migrate-obsolete-instances" 1 (clos:migrate-obsolete-instances))
+(time-run "touch after migration" 1 (touch-nodes *nodes*))
+
+(multiple-value-bind (lazy walked plans) (clos:instance-migration-counts)
+  (format t "~a lazy, ~a walked, ~a plans~%" lazy walked plans))
@@ -0,0 +1,48 @@
+;;;; Measure interrupt delivery latency to a thread spinning in a loop
+;;;; that never allocates, and the cost of the safepoint polls in
+;;;; allocation heavy and non-allocating loops.
+
+(defparameter *delivered* nil)
+
+(defun spin (n)
+  (declare (fixnum n))
+  (let ((x 0))
+    (declare (fixnum x))
+    (dotimes (i n x)
+      (setq x (logand (+ x i) #xffff)))))
+
+(defun measure-latency (trials &optional (iterations 1000000))
+  "Interrupt a thread that calls SPIN with ITERATIONS over and over.  With
+MOST-POSITIVE-FIXNUM iterations the thread stays in one call, so only the
+polls on the loop back edge can deliver the interrupt."
+  (let ((total 0) (worst 0))
+    (dotimes (trial trials)
+      (setq *delivered* nil)
+      (let ((process (mp:process-run-function "spinner"
+                                              (lambda ()
+                                                (catch 'stop
+                                                  (loop (spin iterations)))))))
+        (sleep 0.05)
+        (let ((start (get-internal-real-time)))
+          (mp:interrupt-process process (lambda ()
+                                          (setq *delivered* (get-internal-real-time))
+                                          (throw 'stop nil)))
+          (mp:process-join process)
+          (let ((latency (- *delivered* start)))
+            (incf total latency)
+            (setq worst (max worst latency))))))
+    (format t "interrupt latency (~d iterations/call) mean ~8,6f worst ~8,6f seconds~%"
+            iterations
+            (float (/ total trials internal-time-units-per-second))
+            (float (/ worst internal-time-units-per-second)))))
+
+(defmacro time-loop (name form)
+  `(let ((start (get-internal-real-time)))
+     ,form
+     (format t "~20a ~8,4f seconds~%" ,name
+             (float (/ (- (get-internal-real-time) start) internal-time-units-per-second)))))
+
+(measure-latency 20)
+(measure-latency 20 most-positive-fixnum)
+(time-loop "spin" (spin 100000000))
+(time-loop "cons" (dotimes (i 10000000) (cons i i)))
@@ -0,0 +1,49 @@
+;;;; Measure READ-SEQUENCE and WRITE-SEQUENCE throughput in MB/s for
+;;;; octet and base-char buffers on file streams and string streams.
+
+(defparameter *buffer-size* 65536)
+(defparameter *megabytes* 64)
+(defparameter *file* "/tmp/clasp-tseqio.dat")
+
+(defmacro time-mb (name bytes &body body)
+  (let ((start (gensym))
+        (secs (gensym)))
+    `(let ((,start (get-internal-real-time)))
+       ,@body
+       (let ((,secs (max 1.0e-6 (float (/ (- (get-internal-real-time) ,start) internal-time-units-per-second)))))
+         (format t "~10,2f MB/s ~30a~%" (/ (/ ,bytes 1048576.0) ,secs) ,name)))))
+
+(defun total-bytes () (* *megabytes* 1048576))
+
+(let ((buffer (make-array *buffer-size* :element-type '(unsigned-byte 8) :initial-element 65)))
+  (time-mb "write-sequence octets" (total-bytes)
+    (with-open-file (out *file* :direction :output :if-exists :supersede
+                                :element-type '(unsigned-byte 8))
+      (dotimes (i (floor (total-bytes) *buffer-size*))
+        (write-sequence buffer out))))
+  (time-mb "read-sequence octets" (total-bytes)
+    (with-open-file (in *file* :element-type '(unsigned-byte 8))
+      (loop while (plusp (read-sequence buffer in))))))
+
+(let ((buffer (make-string *buffer-size* :element-type 'base-char :initial-element #\a)))
+  (time-mb "write-sequence base-chars" (total-bytes)
+    (with-open-file (out *file* :direction :output :if-exists :supersede
+                                :external-format :latin-1)
+      (dotimes (i (floor (total-bytes) *buffer-size*))
+        (write-sequence buffer out))))
+  (time-mb "read-sequence base-chars" (total-bytes)
+    (with-open-file (in *file* :external-format :latin-1)
+      (loop while (plusp (read-sequence buffer in))))))
+
+(let* ((buffer (make-string *buffer-size* :element-type 'base-char :initial-element #\a))
+       (bytes (* 8 1048576))
+       (source nil))
+  (time-mb "write-sequence string-output" bytes
+    (setf source (with-output-to-string (out)
+                   (dotimes (i (floor bytes *buffer-size*))
+                     (write-sequence buffer out)))))
+  (time-mb "read-sequence string-input" bytes
+    (with-input-from-string (in source)
+      (loop while (plusp (read-sequence buffer in))))))
+
+(delete-file *file*)
@@ -0,0 +1,46 @@
+;;;; Time SLOT-VALUE through the call site caches against accessors.
+
+(defparameter *n* 10000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defclass point ()
+  ((x :initarg :x :accessor point-x)
+   (y :initarg :y :accessor point-y)))
+
+(defclass point3 (point)
+  ((z :initarg :z :accessor point-z)))
+
+(defun sum-slot-value (p n)
+  (let ((sum 0))
+    (dotimes (i n sum) (setf sum (+ sum (slot-value p 'x))))))
+
+(defun sum-accessor (p n)
+  (let ((sum 0))
+    (dotimes (i n sum) (setf sum (+ sum (point-x p))))))
+
+(defun sum-slot-value-variable (p n name)
+  (let ((sum 0))
+    (dotimes (i n sum) (setf sum (+ sum (slot-value p name))))))
+
+(defun incf-slot-value (p n)
+  (dotimes (i n) (incf (slot-value p 'y))))
+
+(defun incf-accessor (p n)
+  (dotimes (i n) (incf (point-y p))))
+
+(defun sum-slot-value-polymorphic (ps n)
+  (let ((sum 0))
+    (dotimes (i n sum)
+      (setf sum (+ sum (slot-value (svref ps (logand i 1)) 'x))))))
+
+(defparameter *p* (make-instance 'point :x 1 :y 0))
+(defparameter *ps* (vector (make-instance 'point :x 1 :y 0)
+                           (make-instance 'point3 :x 1 :y 0 :z 0)))
+
+(time-run "slot-value constant name" 3 (sum-slot-value *p* *n*))
+(time-run "accessor" 3 (sum-accessor *p* *n*))
+(time-run "slot-value variable name" 3 (sum-slot-value-variable *p* *n* 'x))
+(time-run "incf slot-value" 3 (incf-slot-value *p* *n*))
+(time-run "incf accessor" 3 (incf-accessor *p* *n*))
+(time-run "slot-value two classes" 3 (sum-slot-value-polymorphic *ps* *n*))
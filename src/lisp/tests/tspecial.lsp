@@ -0,0 +1,40 @@
+;;;; Time reading and binding special variables in tight loops.
+;;;; *never-bound* is only ever read - its value comes straight from the symbol.
+;;;; *rebound* has a thread local binding index so reads check this thread's table.
+
+(load "sys:tests;benchmark.lsp")
+
+(defvar *never-bound* 1)
+(defvar *rebound* 1)
+(let ((*rebound* 2)) *rebound*)
+
+(defun do-read-never-bound (n)
+  (let ((sum 0))
+    (dotimes (i n) (setq sum (+ sum *never-bound*)))
+    sum))
+(time-run "10^7 reads never bound" 1 (do-read-never-bound 10000000))
+
+(defun do-read-rebound (n)
+  (let ((sum 0))
+    (dotimes (i n) (setq sum (+ sum *rebound*)))
+    sum))
+(time-run "10^7 reads rebound" 1 (do-read-rebound 10000000))
+
+(defun do-read-inside-binding (n)
+  (let ((*rebound* 3)
+        (sum 0))
+    (dotimes (i n) (setq sum (+ sum *rebound*)))
+    sum))
+(time-run "10^7 reads inside binding" 1 (do-read-inside-binding 10000000))
+
+(defun do-read-standard-output (n)
+  (dotimes (i n) *standard-output*))
+(time-run "10^7 reads *standard-output*" 1 (do-read-standard-output 10000000))
+
+(defun do-bind (n)
+  (dotimes (i n) (let ((*rebound* i)) *rebound*)))
+(time-run "10^6 binds" 1 (do-bind 1000000))
+
+(defun do-bind-print (n)
+  (dotimes (i n) (let ((*print-pretty* nil) (*read-base* 10)) *print-pretty*)))
+(time-run "10^6 binds of print specials" 1 (do-bind-print 1000000))
@@ -0,0 +1,32 @@
+;;;; Time WITH-OUTPUT-TO-STRING and GET-OUTPUT-STREAM-STRING on large
+;;;; outputs, the way JSON and HTML generators use them.
+
+(defparameter *lines* 200000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defparameter *row* "{\"id\": 12345, \"name\": \"some name\", \"tags\": [\"a\", \"b\"]},")
+(defparameter *wide-row* (concatenate 'string *row* (string (code-char #x3bb))))
+
+(defun emit (row)
+  (with-output-to-string (s)
+    (dotimes (i *lines*)
+      (write-string row s)
+      (write-char #\Newline s))))
+
+(defun emit-chars (row)
+  (with-output-to-string (s)
+    (dotimes (i *lines*)
+      (loop for c across row do (write-char c s))
+      (write-char #\Newline s))))
+
+(time-run "write-string base" 5 (emit *row*))
+(time-run "write-string wide" 5 (emit *wide-row*))
+(time-run "write-char base" 5 (emit-chars *row*))
+(time-run "format ~a" 5 (with-output-to-string (s)
+                          (dotimes (i *lines*) (format s "~a~%" i))))
+(time-run "write-output-stream-string" 5
+          (let ((s (make-string-output-stream)))
+            (dotimes (i *lines*) (write-string *row* s))
+            (with-open-file (out "/dev/null" :direction :output :if-exists :append)
+              (core:write-output-stream-string s out))))
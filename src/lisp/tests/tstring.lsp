@@ -0,0 +1,22 @@
+;;;; Time the string search and comparison kernels on multi-MB strings.
+
+(defparameter *size* 8000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defparameter *base* (make-string *size* :element-type 'base-char :initial-element #\a))
+(defparameter *wide* (make-string *size* :initial-element #\a))
+(setf (char *base* (- *size* 10)) #\x
+      (char *wide* (- *size* 10)) #\x)
+(defparameter *base-copy* (copy-seq *base*))
+(defparameter *upcased* (string-upcase *base*))
+
+(time-run "search base" 10 (search "aaax" *base*))
+(time-run "search character" 10 (search "aaax" *wide*))
+(time-run "search char-equal" 10 (search "AAAX" *base* :test #'char-equal))
+(time-run "position base" 10 (position #\x *base*))
+(time-run "position character" 10 (position #\x *wide*))
+(time-run "position :from-end" 10 (position #\b *base* :from-end t))
+(time-run "string=" 10 (string= *base* *base-copy*))
+(time-run "string-equal" 10 (string-equal *base* *upcased*))
+(time-run "equal" 10 (equal *base* *base-copy*))
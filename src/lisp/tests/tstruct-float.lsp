@@ -0,0 +1,47 @@
+;;;; Time numerical code on structures of floats, with unboxed and boxed slots.
+
+(defparameter *n* 1000000)
+
+(load "sys:tests;benchmark.lsp")
+
+(defstruct particle
+  (x 0d0 :type double-float)
+  (y 0d0 :type double-float)
+  (vx 0d0 :type double-float)
+  (vy 0d0 :type double-float))
+
+;;; The same, with slot types that are kept boxed.
+(defstruct boxed-particle
+  (x 0d0 :type (or null double-float))
+  (y 0d0 :type (or null double-float))
+  (vx 0d0 :type (or null double-float))
+  (vy 0d0 :type (or null double-float)))
+
+(defun step-particle (p dt)
+  (declare (type particle p) (double-float dt))
+  (setf (particle-x p) (+ (particle-x p) (* dt (particle-vx p)))
+        (particle-y p) (+ (particle-y p) (* dt (particle-vy p)))))
+
+(defun step-boxed-particle (p dt)
+  (declare (type boxed-particle p) (double-float dt))
+  (setf (boxed-particle-x p) (+ (boxed-particle-x p) (* dt (boxed-particle-vx p)))
+        (boxed-particle-y p) (+ (boxed-particle-y p) (* dt (boxed-particle-vy p)))))
+
+(defun run-particles (n)
+  (let ((p (make-particle :vx 1d0 :vy -1d0)))
+    (dotimes (i n (particle-x p)) (step-particle p 1d-3))))
+
+(defun run-boxed-particles (n)
+  (let ((p (make-boxed-particle :vx 1d0 :vy -1d0)))
+    (dotimes (i n (boxed-particle-x p)) (step-boxed-particle p 1d-3))))
+
+(defun make-particles (n)
+  (dotimes (i n) (make-particle :x 1d0 :y 2d0)))
+
+(defun make-boxed-particles (n)
+  (dotimes (i n) (make-boxed-particle :x 1d0 :y 2d0)))
+
+(time-run "unboxed step" 3 (run-particles *n*))
+(time-run "boxed step" 3 (run-boxed-particles *n*))
+(time-run "unboxed construct" 3 (make-particles *n*))
+(time-run "boxed construct" 3 (make-boxed-particles *n*))
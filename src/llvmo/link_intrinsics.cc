@@ -260,18 +260,15 @@ LtvcReturn ltvc_nconc(gctools::GCRootsInModule* holder, char tag, size_t index,
 
 NOINLINE LtvcReturn ltvc_make_list(gctools::GCRootsInModule* holder, char tag, size_t index, size_t num, ... )
 {NO_UNWIND_BEGIN();
-  core::T_sp first;
-  core::T_sp* cur = &first;
+  core::T_sp val = _Nil<core::T_O>();
   va_list va;
   va_start(va,num);
-  for (; num; --num) {
-    gctools::Tagged p = va_arg(va, gctools::Tagged);
-    Cons_sp one = Cons_O::create(core::T_sp(p),_Nil<core::T_O>());
-    *cur = one;
-    cur = &one->_Cdr;
+  if (num) {
+    val = gctools::ConsAllocator<core::Cons_O>::allocate_list(num,
+                                                              [&va] (size_t) { return core::T_sp(va_arg(va, gctools::Tagged)); },
+                                                              _Nil<core::T_O>());
   }
   va_end(va);
-  core::T_sp val = first;
   LTVCRETURN holder->setTaggedIndex(tag,index,val.tagged_());
   NO_UNWIND_END();
 }
@@ -769,6 +766,13 @@ __attribute__((optnone,noinline)) void cc_protect_alloca(char* ptr)
   (void)ptr;
 }
 
+/*! Compiled code calls this at function entry and loop heads
+when clasp_safepoint_word is nonzero */
+void cc_safepoint()
+{
+  gctools::handle_all_queued_interrupts();
+}
+
 
 void cc_invoke_sub_run_all_function(fnStartUp fptr) {
   fptr();
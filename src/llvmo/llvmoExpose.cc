@@ -109,6 +109,7 @@ THE SOFTWARE.
 #include <clasp/core/lightProfiler.h>
 #include <clasp/llvmo/insertPoint.h>
 #include <clasp/llvmo/debugLoc.h>
+#include <clasp/llvmo/sourcePositionTable.h>
 #include <clasp/llvmo/intrinsics.h>
 #include <clasp/core/external_wrappers.h>
 #include <clasp/core/wrappers.h>
@@ -2964,6 +2965,27 @@ CL_DEFUN void finalizeEngineAndRegisterWithGcAndRunMainFunctions(ExecutionEngine
 #endif
   }
 
+/*! RuntimeDyld doesn't run the constructors of an object file, so a fasl
+    written as an object calls them from one external function instead. */
+CL_DOCSTRING("Replace the llvm.global_ctors of MODULE with an external function that calls the constructors in priority order - see llvm-sys:load-object-fasl");
+CL_DEFUN void llvm_sys__lower_global_ctors(Module_sp module) {
+  llvm::Module* M = module->wrappedPtr();
+  std::vector<std::pair<unsigned,llvm::Function*>> ctors;
+  for ( auto ctor : llvm::orc::getConstructors(*M) ) {
+    if (ctor.Func) ctors.emplace_back(ctor.Priority,ctor.Func);
+  }
+  std::stable_sort(ctors.begin(),ctors.end(),[](const std::pair<unsigned,llvm::Function*>& x, const std::pair<unsigned,llvm::Function*>& y) { return x.first < y.first; });
+  llvm::LLVMContext& context = M->getContext();
+  llvm::FunctionType* fntype = llvm::FunctionType::get(llvm::Type::getVoidTy(context),false);
+  llvm::Function* init = llvm::Function::Create(fntype,llvm::GlobalValue::ExternalLinkage,CLASP_FASL_INIT_FUNCTION_NAME,M);
+  llvm::IRBuilder<> builder(llvm::BasicBlock::Create(context,"entry",init));
+  for ( auto& ctor : ctors ) builder.CreateCall(ctor.second);
+  builder.CreateRetVoid();
+  if (llvm::GlobalVariable* global = M->getNamedGlobal("llvm.global_ctors")) {
+    global->eraseFromParent();
+  }
+}
+
 
 /*! Return (values target nil) if successful or (values nil error-message) if not */
   CL_DEFUN core::T_mv TargetRegistryLookupTarget(const std::string &ArchName, Triple_sp triple) {
@@ -3566,6 +3588,7 @@ ClaspJIT_O::ClaspJIT_O() : TM(EngineBuilder().selectTarget()),
                                          this->GDBEventListener->NotifyObjectEmitted(*(Obj->getBinary()), Info);
 #endif
                                          save_symbol_info(*(Obj->getBinary()), Info);
+                                         register_object_source_positions(*(Obj->getBinary()), Info);
                                        }),
                            CompileLayer(ObjectLayer, SimpleCompiler(*TM)),
                            OptimizeLayer(CompileLayer,
@@ -3746,6 +3769,93 @@ CL_DEFMETHOD bool ClaspJIT_O::removeModule(ModuleHandle_sp H) {
   return true;
 }
 
+/*! Object fasls are all linked into this one object layer, which lives as
+    long as the image, rather than each getting an ExecutionEngine and a
+    Module of its own.  Every fasl defines CLASP_FASL_INIT_FUNCTION_NAME so
+    it is looked up in the handle of the fasl being loaded. */
+class ObjectFaslLinker {
+public:
+#ifdef CLASP_THREADS
+  mp::Mutex _Mutex;
+#endif
+  std::unique_ptr<llvm::TargetMachine> _TargetMachine;
+  const llvm::DataLayout _DataLayout;
+  RTDyldObjectLinkingLayer _ObjectLayer;
+  ObjectFaslLinker() :
+#ifdef CLASP_THREADS
+                       _Mutex(OBJFASLS_NAMEWORD),
+#endif
+                       _TargetMachine(EngineBuilder().selectTarget()),
+                       _DataLayout(_TargetMachine->createDataLayout()),
+                       _ObjectLayer([]() { return std::make_shared<ClaspSectionMemoryManager>(); },
+                                    [](llvm::orc::RTDyldObjectLinkingLayer::ObjHandleT H,
+                                       const RTDyldObjectLinkingLayerBase::ObjectPtr& Obj,
+                                       const RuntimeDyld::LoadedObjectInfo &Info) {
+                                      // Source positions come from the table written next to the fasl
+                                      save_symbol_info(*(Obj->getBinary()), Info);
+                                    }) {};
+};
+
+static ObjectFaslLinker& object_fasl_linker() {
+  static ObjectFaslLinker linker;
+  return linker;
+}
+
+void loadObjectFaslAndRunInitFunction(std::unique_ptr<llvm::object::ObjectFile> object, std::unique_ptr<llvm::MemoryBuffer> buffer, const std::string& fasl) {
+  ObjectFaslLinker& linker = object_fasl_linker();
+  uint64_t address = 0;
+  {
+    // The init function may load other fasls so the lock is released before it runs
+    WITH_READ_WRITE_LOCK(linker._Mutex);
+    // Like an ExecutionEngine, a fasl only resolves its undefined symbols against this process
+    auto Resolver = createLambdaResolver(
+                                         [](const std::string &Name) {
+                                           return JITSymbol(nullptr);
+                                         },
+                                         [](const std::string &Name) {
+                                           if (auto SymAddr =
+                                               RTDyldMemoryManager::getSymbolAddressInProcess(Name))
+                                             return JITSymbol(SymAddr, JITSymbolFlags::Exported);
+                                           return JITSymbol(nullptr);
+                                         });
+    auto binary = std::make_shared<llvm::object::OwningBinary<llvm::object::ObjectFile>>(std::move(object),std::move(buffer));
+    Expected<llvm::orc::RTDyldObjectLinkingLayer::ObjHandleT> handle = linker._ObjectLayer.addObject(std::move(binary),std::move(Resolver));
+    if (!handle) {
+      SIMPLE_ERROR(BF("Could not link the object fasl %s - %s") % fasl % llvm::toString(handle.takeError()));
+    }
+    core::LightTimer timer;
+    timer.start();
+    if (llvm::Error error = linker._ObjectLayer.emitAndFinalize(*handle)) {
+      SIMPLE_ERROR(BF("Could not relocate the object fasl %s - %s") % fasl % llvm::toString(std::move(error)));
+    }
+    timer.stop();
+    llvm_sys__accumulate_llvm_usage_seconds(timer.getAccumulatedTime());
+    std::string MangledName;
+    raw_string_ostream MangledNameStream(MangledName);
+    llvm::Mangler::getNameWithPrefix(MangledNameStream, CLASP_FASL_INIT_FUNCTION_NAME, linker._DataLayout);
+    llvm::JITSymbol sym = linker._ObjectLayer.findSymbolIn(*handle, MangledNameStream.str(), false);
+    if (sym) {
+      Expected<llvm::JITTargetAddress> expected_address = sym.getAddress();
+      if (expected_address) {
+        address = *expected_address;
+      } else {
+        llvm::consumeError(expected_address.takeError());
+      }
+    }
+  }
+  if (address == 0) {
+    SIMPLE_ERROR(BF("The object fasl %s has no %s function") % fasl % CLASP_FASL_INIT_FUNCTION_NAME);
+  }
+  // The init function is also the anchor of the fasl's source position table
+  map_fasl_source_position_table(fasl, 0, address);
+  ((void(*)())address)();
+  if ( core::startup_functions_are_waiting() ) {
+    core::startup_functions_invoke();
+  } else {
+    SIMPLE_ERROR(BF("There were no startup functions to invoke\n"));
+  }
+}
+
 
 /*! Remove the llvm.global_ctors array and any functions contained within it.
     The proper way to remove them is to never allow them into the Module.
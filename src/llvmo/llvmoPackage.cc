@@ -29,6 +29,8 @@ THE SOFTWARE.
 #include <stdint.h>
 
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Object/ObjectFile.h>
 #include <clasp/core/object.h>
 #include <clasp/core/lisp.h>
 #include <clasp/core/fileSystem.h>
@@ -157,6 +159,31 @@ CL_DEFUN bool llvm_sys__load_bitcode(core::Pathname_sp filename, bool verbose, b
   return true;
 }
 
+CL_DOCSTRING("Load a fasl written as a native object file (see cmp:*link-fasls-in-process*).  The object is only relocated and linked against this process, nothing is compiled.");
+CL_LAMBDA(filename &optional verbose print external_format);
+CL_DEFUN bool llvm_sys__load_object_fasl(core::Pathname_sp filename, bool verbose, bool print, core::T_sp externalFormat )
+{
+  core::DynamicScopeManager scope(::cl::_sym_STARpackageSTAR, ::cl::_sym_STARpackageSTAR->symbolValue());
+  core::T_sp tnamestring = cl__namestring(cl__truename(filename));
+  if ( tnamestring.nilp() ) {
+    SIMPLE_ERROR(BF("Could not create namestring for %s") % _rep_(filename));
+  }
+  if (comp::_sym_STARllvm_contextSTAR->symbolValue().nilp()) {
+    SIMPLE_ERROR(BF("The cmp:*llvm-context* is NIL"));
+  }
+  std::string namestring = gctools::As<core::String_sp>(tnamestring)->get_std_string();
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer = llvm::MemoryBuffer::getFile(namestring);
+  if (!buffer) {
+    SIMPLE_ERROR(BF("Could not read %s - %s") % namestring % buffer.getError().message());
+  }
+  llvm::Expected<std::unique_ptr<llvm::object::ObjectFile>> object = llvm::object::ObjectFile::createObjectFile((*buffer)->getMemBufferRef());
+  if (!object) {
+    SIMPLE_ERROR(BF("Could not read object file %s - %s") % namestring % llvm::toString(object.takeError()));
+  }
+  loadObjectFaslAndRunInitFunction(std::move(*object),std::move(*buffer),namestring);
+  return true;
+}
+
 CL_DOCSTRING("Load a module into the Common Lisp environment as if it were loaded from a bitcode file");
 
 CL_LAMBDA(filename &optional verbose print external_format);
@@ -0,0 +1,371 @@
+/*
+    File: sourcePositionTable.cc
+*/
+
+/*
+Copyright (c) 2014, Christian E. Schafmeister
+ 
+CLASP is free software; you can redistribute it and/or
+modify it under the terms of the GNU Library General Public
+License as published by the Free Software Foundation; either
+version 2 of the License, or (at your option) any later version.
+ 
+See directory 'clasp/licenses' for full details.
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/* -^- */
+//#define DEBUG_LEVEL_FULL
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <mutex>
+#include <clasp/core/foundation.h>
+
+#include <llvm/DebugInfo/DWARF/DWARFContext.h>
+#include <llvm/Support/LEB128.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <clasp/core/object.h>
+#include <clasp/core/lisp.h>
+#include <clasp/core/array.h>
+#include <clasp/core/pointer.h>
+#include <clasp/core/numbers.h>
+#include <clasp/llvmo/llvmoPackage.h>
+#include <clasp/llvmo/sourcePositionTable.h>
+#include <clasp/core/symbolTable.h>
+#include <clasp/core/wrappers.h>
+
+namespace llvmo {
+
+struct RegisteredSourcePositionTable {
+  uintptr_t _Start;
+  uintptr_t _End;
+  uintptr_t _Base;
+  const SourcePositionTableHeader* _Header;
+};
+
+static std::mutex global_source_position_tables_mutex;
+static std::vector<RegisteredSourcePositionTable> global_source_position_tables;
+static size_t global_source_position_tables_bytes = 0;
+
+struct SourcePositionRow {
+  uint64_t _Address;
+  uint32_t _File;
+  uint32_t _Line;
+  uint32_t _Column;
+};
+
+static void register_source_position_table(uintptr_t base, const SourcePositionTableHeader* header) {
+  RegisteredSourcePositionTable table;
+  table._Start = base + header->_Start;
+  table._End = base + header->_End + 1;
+  table._Base = base;
+  table._Header = header;
+  std::lock_guard<std::mutex> guard(global_source_position_tables_mutex);
+  auto it = std::upper_bound(global_source_position_tables.begin(), global_source_position_tables.end(), table,
+                             [](const RegisteredSourcePositionTable& x, const RegisteredSourcePositionTable& y) { return x._Start < y._Start; });
+  global_source_position_tables.insert(it, table);
+  global_source_position_tables_bytes += header->_Size;
+}
+
+/*! Copy a table built in memory into its own mapping, make it read-only and register it */
+static void register_source_position_table_copy(uintptr_t base, const std::string& table) {
+  void* mem = mmap(NULL, table.size(), PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED) return;
+  memcpy(mem, table.data(), table.size());
+  mprotect(mem, table.size(), PROT_READ);
+  register_source_position_table(base, reinterpret_cast<const SourcePositionTableHeader*>(mem));
+}
+
+/*! Collect the rows of every line table in CONTEXT sorted by address */
+static void collect_source_position_rows(llvm::DWARFContext& context, std::vector<SourcePositionRow>& rows, std::string& names, uint32_t& num_files) {
+  std::map<std::string, uint32_t> file_indices;
+  for (const auto& unit : context.compile_units()) {
+    const llvm::DWARFDebugLine::LineTable* line_table = context.getLineTableForUnit(unit.get());
+    if (!line_table) continue;
+    std::map<uint32_t, uint32_t> unit_files;
+    for (const auto& row : line_table->Rows) {
+      SourcePositionRow entry;
+      entry._Address = row.Address;
+      entry._File = 0;
+      entry._Line = row.EndSequence ? 0 : row.Line;
+      entry._Column = row.EndSequence ? 0 : row.Column;
+      if (!row.EndSequence) {
+        auto found = unit_files.find(row.File);
+        if (found != unit_files.end()) {
+          entry._File = found->second;
+        } else {
+          std::string name;
+          line_table->getFileNameByIndex(row.File, unit->getCompilationDir(),
+                                         llvm::DILineInfoSpecifier::FileLineInfoKind::AbsoluteFilePath, name);
+          auto known = file_indices.find(name);
+          if (known == file_indices.end()) {
+            uint32_t index = file_indices.size();
+            file_indices[name] = index;
+            names += name;
+            names.push_back('\0');
+            entry._File = index;
+          } else {
+            entry._File = known->second;
+          }
+          unit_files[row.File] = entry._File;
+        }
+      }
+      rows.push_back(entry);
+    }
+  }
+  num_files = file_indices.size();
+  std::stable_sort(rows.begin(), rows.end(), [](const SourcePositionRow& x, const SourcePositionRow& y) { return x._Address < y._Address; });
+}
+
+/*! Lay out the complete table for ROWS, which must not be empty */
+static std::string encode_source_position_table(const std::vector<SourcePositionRow>& rows, const std::string& names, uint32_t num_files) {
+  std::vector<SourcePositionCheckpoint> checkpoints;
+  std::string encoded;
+  llvm::raw_string_ostream out(encoded);
+  SourcePositionRow prev = {0, 0, 0, 0};
+  for (size_t i = 0; i < rows.size(); ++i) {
+    const SourcePositionRow& row = rows[i];
+    llvm::encodeULEB128(row._Address - prev._Address, out);
+    llvm::encodeSLEB128((int64_t)row._File - (int64_t)prev._File, out);
+    llvm::encodeSLEB128((int64_t)row._Line - (int64_t)prev._Line, out);
+    llvm::encodeULEB128(row._Column, out);
+    prev = row;
+    if (i % SOURCE_POSITION_CHECKPOINT_INTERVAL == 0) {
+      out.flush();
+      SourcePositionCheckpoint checkpoint;
+      checkpoint._Address = row._Address;
+      checkpoint._File = row._File;
+      checkpoint._Line = row._Line;
+      checkpoint._Column = row._Column;
+      checkpoint._NextRowOffset = encoded.size();
+      checkpoints.push_back(checkpoint);
+    }
+  }
+  out.flush();
+  size_t names_offset = sizeof(SourcePositionTableHeader);
+  size_t checkpoints_offset = (names_offset + names.size() + 7) & ~(size_t)7;
+  size_t rows_offset = checkpoints_offset + checkpoints.size()*sizeof(SourcePositionCheckpoint);
+  std::string table(rows_offset + encoded.size(), '\0');
+  SourcePositionTableHeader* header = reinterpret_cast<SourcePositionTableHeader*>(&table[0]);
+  header->_Magic = SOURCE_POSITION_TABLE_MAGIC;
+  header->_Version = SOURCE_POSITION_TABLE_VERSION;
+  header->_Start = rows.front()._Address;
+  header->_End = rows.back()._Address;
+  header->_NumFiles = num_files;
+  header->_NumRows = rows.size();
+  header->_NumCheckpoints = checkpoints.size();
+  header->_FileNamesOffset = names_offset;
+  header->_CheckpointsOffset = checkpoints_offset;
+  header->_RowsOffset = rows_offset;
+  header->_Size = table.size();
+  memcpy(&table[names_offset], names.data(), names.size());
+  memcpy(&table[checkpoints_offset], checkpoints.data(), checkpoints.size()*sizeof(SourcePositionCheckpoint));
+  memcpy(&table[rows_offset], encoded.data(), encoded.size());
+  return table;
+}
+
+void register_object_source_positions(const llvm::object::ObjectFile& object_file, const llvm::RuntimeDyld::LoadedObjectInfo& loaded_object_info) {
+  // The debug object has its sections at their load addresses.  Mach-O has no
+  // debug object so there the debug sections are relocated with the load addresses.
+  llvm::object::OwningBinary<llvm::object::ObjectFile> debug_object = loaded_object_info.getObjectForDebug(object_file);
+  std::unique_ptr<llvm::DWARFContext> context = debug_object.getBinary()
+    ? llvm::DWARFContext::create(*debug_object.getBinary())
+    : llvm::DWARFContext::create(object_file, &loaded_object_info);
+  std::vector<SourcePositionRow> rows;
+  std::string names;
+  uint32_t num_files;
+  collect_source_position_rows(*context, rows, names, num_files);
+  if (rows.empty()) return;
+  uint64_t base = rows.front()._Address;
+  for (auto& row : rows) row._Address -= base;
+  register_source_position_table_copy(base, encode_source_position_table(rows, names, num_files));
+}
+
+std::string fasl_source_position_table_filename(const std::string& fasl) {
+  return fasl + ".spt";
+}
+
+/*! The sections of a relocatable object are placed independently when it is
+    loaded, so one anchor symbol places its rows only if all the code is in one */
+static bool single_text_section_p(const llvm::object::ObjectFile& object) {
+  size_t count = 0;
+  for (const llvm::object::SectionRef& section : object.sections()) {
+    if (section.isText() && section.getSize() > 0) ++count;
+  }
+  return count == 1;
+}
+
+static bool find_anchor_address(const llvm::object::ObjectFile& object, uint64_t& anchor) {
+  for (const llvm::object::SymbolRef& symbol : object.symbols()) {
+    llvm::Expected<llvm::StringRef> name = symbol.getName();
+    if (!name) {
+      llvm::consumeError(name.takeError());
+      continue;
+    }
+    // Mach-O prefixes C names with an underscore
+    if (*name == CLASP_FASL_INIT_FUNCTION_NAME || *name == "_" CLASP_FASL_INIT_FUNCTION_NAME) {
+      llvm::Expected<uint64_t> address = symbol.getAddress();
+      if (!address) {
+        llvm::consumeError(address.takeError());
+        return false;
+      }
+      anchor = *address;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool write_fasl_source_position_table(const std::string& fasl) {
+  std::string filename = fasl_source_position_table_filename(fasl);
+  // Never leave the table of an older fasl behind
+  unlink(filename.c_str());
+  llvm::Expected<llvm::object::OwningBinary<llvm::object::ObjectFile>> binary = llvm::object::ObjectFile::createObjectFile(fasl);
+  if (!binary) {
+    llvm::consumeError(binary.takeError());
+    return false;
+  }
+  const llvm::object::ObjectFile& object = *binary->getBinary();
+  uint32_t flags = 0;
+  uint64_t anchor = 0;
+  if (object.isRelocatableObject()) {
+    if (!single_text_section_p(object) || !find_anchor_address(object, anchor)) return false;
+    flags |= SOURCE_POSITION_TABLE_ANCHORED;
+  }
+  std::unique_ptr<llvm::DWARFContext> context = llvm::DWARFContext::create(object);
+  std::vector<SourcePositionRow> rows;
+  std::string names;
+  uint32_t num_files;
+  collect_source_position_rows(*context, rows, names, num_files);
+  if (rows.empty()) return false;
+  std::string table = encode_source_position_table(rows, names, num_files);
+  SourcePositionTableHeader* header = reinterpret_cast<SourcePositionTableHeader*>(&table[0]);
+  header->_Flags = flags;
+  header->_Anchor = anchor;
+  header->_ObjectSize = object.getData().size();
+  // Write under another name so a partial table is never mapped
+  std::string temp = filename + ".tmp";
+  FILE* fout = fopen(temp.c_str(), "w");
+  if (!fout) return false;
+  size_t written = fwrite(table.data(), 1, table.size(), fout);
+  if (fclose(fout) != 0 || written != table.size()) {
+    unlink(temp.c_str());
+    return false;
+  }
+  return rename(temp.c_str(), filename.c_str()) == 0;
+}
+
+bool map_fasl_source_position_table(const std::string& fasl, uintptr_t load_bias, uintptr_t anchor_address) {
+  std::string filename = fasl_source_position_table_filename(fasl);
+  struct stat fasl_stat, table_stat;
+  if (stat(fasl.c_str(), &fasl_stat) != 0) return false;
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  if (fstat(fd, &table_stat) != 0 || (size_t)table_stat.st_size < sizeof(SourcePositionTableHeader)) {
+    close(fd);
+    return false;
+  }
+  size_t size = table_stat.st_size;
+  void* mem = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) return false;
+  const SourcePositionTableHeader* header = reinterpret_cast<const SourcePositionTableHeader*>(mem);
+  bool anchored = header->_Flags & SOURCE_POSITION_TABLE_ANCHORED;
+  if (header->_Magic != SOURCE_POSITION_TABLE_MAGIC ||
+      header->_Version != SOURCE_POSITION_TABLE_VERSION ||
+      header->_Size != size ||
+      header->_ObjectSize != (uint64_t)fasl_stat.st_size ||
+      (anchored && anchor_address == 0)) {
+    munmap(mem, size);
+    return false;
+  }
+  register_source_position_table(anchored ? anchor_address - header->_Anchor : load_bias, header);
+  return true;
+}
+
+static bool table_lookup(const SourcePositionTableHeader* header, uint64_t offset, const char*& file, uint32_t& line, uint32_t& column) {
+  const char* data = reinterpret_cast<const char*>(header);
+  const SourcePositionCheckpoint* checkpoints = reinterpret_cast<const SourcePositionCheckpoint*>(data + header->_CheckpointsOffset);
+  const SourcePositionCheckpoint* checkpoints_end = checkpoints + header->_NumCheckpoints;
+  const SourcePositionCheckpoint* cp = std::upper_bound(checkpoints, checkpoints_end, offset,
+                                                        [](uint64_t x, const SourcePositionCheckpoint& y) { return x < y._Address; });
+  if (cp == checkpoints) return false;
+  --cp;
+  SourcePositionCheckpoint state = *cp;
+  const uint8_t* cur = reinterpret_cast<const uint8_t*>(data + header->_RowsOffset + state._NextRowOffset);
+  const uint8_t* end = reinterpret_cast<const uint8_t*>(data + header->_Size);
+  size_t row = (cp - checkpoints) * SOURCE_POSITION_CHECKPOINT_INTERVAL + 1;
+  for ( ; row < header->_NumRows && cur < end; ++row) {
+    unsigned n;
+    uint64_t address = state._Address + llvm::decodeULEB128(cur, &n);
+    if (address > offset) break;
+    cur += n;
+    uint32_t file = state._File + llvm::decodeSLEB128(cur, &n);
+    cur += n;
+    uint32_t l = state._Line + llvm::decodeSLEB128(cur, &n);
+    cur += n;
+    uint32_t c = llvm::decodeULEB128(cur, &n);
+    cur += n;
+    state._Address = address;
+    state._File = file;
+    state._Line = l;
+    state._Column = c;
+  }
+  if (state._Line == 0) return false; // between sequences
+  const char* name = data + header->_FileNamesOffset;
+  for (uint32_t i = 0; i < state._File; ++i) name += strlen(name) + 1;
+  file = name;
+  line = state._Line;
+  column = state._Column;
+  return true;
+}
+
+bool lookup_source_position(uintptr_t address, const char*& file, uint32_t& line, uint32_t& column) {
+  std::lock_guard<std::mutex> guard(global_source_position_tables_mutex);
+  auto it = std::upper_bound(global_source_position_tables.begin(), global_source_position_tables.end(), address,
+                             [](uintptr_t x, const RegisteredSourcePositionTable& y) { return x < y._Start; });
+  if (it == global_source_position_tables.begin()) return false;
+  --it;
+  if (address >= it->_End) return false;
+  return table_lookup(it->_Header, address - it->_Base, file, line, column);
+}
+
+CL_LAMBDA(address);
+CL_DOCSTRING("Return (values file line column) for a code address in JIT-ed code, or NIL if it isn't covered by a source position table");
+CL_DEFUN core::T_mv llvm_sys__source_position_at(core::Pointer_sp address) {
+  const char* file;
+  uint32_t line, column;
+  if (lookup_source_position((uintptr_t)address->ptr(), file, line, column)) {
+    return Values(core::SimpleBaseString_O::make(file),
+                  core::clasp_make_integer(line),
+                  core::clasp_make_integer(column));
+  }
+  return Values(_Nil<core::T_O>());
+}
+
+CL_LAMBDA(fasl);
+CL_DOCSTRING("Write the source position table of the fasl FASL (a namestring) next to it so LOAD can map it.  Return T if FASL had line information that could be written.");
+CL_DEFUN bool llvm_sys__write_source_position_table(core::String_sp fasl) {
+  return write_fasl_source_position_table(fasl->get_std_string());
+}
+
+CL_DOCSTRING("Return (values number-of-tables bytes) for the registered source position tables");
+CL_DEFUN core::T_mv llvm_sys__source_position_tables_info() {
+  std::lock_guard<std::mutex> guard(global_source_position_tables_mutex);
+  return Values(core::clasp_make_integer(global_source_position_tables.size()),
+                core::clasp_make_integer(global_source_position_tables_bytes));
+}
+
+};
@@ -108,11 +108,13 @@ SRC_CORE_FILES = \
         'derivableCxxObject',
         'null',
         'character',
+        'unicodeTables',
         'designators',
         'sequence',
         'loadTimeValues',
 #        'reader',
         'lightProfiler',
+        'sampleProfiler',
         'fileSystem',
         'intArray',
         'posixTime',
@@ -175,6 +177,7 @@ def collect_clasp_c_source_files(bld):
                  'debugInfoExpose',
                  'debugLoc',
                  'llvmoDwarf',
+                 'sourcePositionTable',
                  'link_intrinsics',
                  'builtins',
                  'fastgf',
@@ -0,0 +1,138 @@
+#-*- mode: python; coding: utf-8-unix -*-
+#
+# Generate src/core/unicodeTables.cc, the character property tables behind
+# graphic-char-p, alpha-char-p, upper-case-p, char-upcase and friends.
+#
+#   python3 tools-for-build/unicode_tables.py > src/core/unicodeTables.cc
+#
+# The data comes from the Unicode Character Database that ships with the
+# Python running this script (unicodedata.unidata_version).
+#
+# Every code point maps to one of a few hundred property records through a
+# two level table: the high bits of the code select a block of
+# 2^UNICODE_BLOCK_SHIFT record indices, the low bits index into it.
+# Identical blocks are stored once, which keeps the whole thing around 40KB.
+#
+# Case follows the CLHS rather than the full Unicode case mapping: a
+# character is upper (lower) case only if it has a one character lower
+# (upper) case mapping that maps back to it, and both characters are base
+# characters or neither is - so STRING-UPCASE of a base string is a base string.
+
+import sys
+import unicodedata
+
+UNICODE_BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << UNICODE_BLOCK_SHIFT
+CHAR_CODE_LIMIT = 0x110000
+BASE_CHAR_LIMIT = 256
+
+# Must match the unicode_* flags in include/clasp/core/character.h
+UPPER = 1
+LOWER = 2
+ALPHA = 4
+ALPHANUMERIC = 8
+GRAPHIC = 16
+
+CATEGORIES = ["Cn", "Lu", "Ll", "Lt", "Lm", "Lo",
+              "Mn", "Mc", "Me", "Nd", "Nl", "No",
+              "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+              "Sm", "Sc", "Sk", "So",
+              "Zs", "Zl", "Zp",
+              "Cc", "Cf", "Cs", "Co"]
+
+# Translated from the ccl definition of %control-char-p, as graphic-char-p
+# has always been in clasp
+NOT_GRAPHIC = [(0x00, 0x1f), (0x7f, 0x9f), (0x34f, 0x34f),
+               (0x200c, 0x200f), (0x202a, 0x202e), (0x2060, 0x2063),
+               (0x206a, 0x206f), (0xf700, 0xf7ff), (0xfe00, 0xfe0f),
+               (0xfeff, 0xfeff), (0xfff0, 0xfffd), (0xe0000, 0xefffd)]
+
+def simple_mapping(ch, mapped):
+    return ord(mapped) if len(mapped) == 1 else ord(ch)
+
+def same_width(a, b):
+    return (a < BASE_CHAR_LIMIT) == (b < BASE_CHAR_LIMIT)
+
+def properties(code):
+    ch = chr(code)
+    category = unicodedata.category(ch)
+    flags = 0
+    delta = 0
+    lower = simple_mapping(ch, ch.lower())
+    upper = simple_mapping(ch, ch.upper())
+    if lower != code and chr(lower).upper() == ch and same_width(code, lower):
+        flags |= UPPER
+        delta = lower - code
+    elif upper != code and chr(upper).lower() == ch and same_width(code, upper):
+        flags |= LOWER
+        delta = upper - code
+    # Characters with case have to be alphabetic, that picks up the
+    # circled letters and roman numerals
+    if category[0] == "L" or flags & (UPPER | LOWER):
+        flags |= ALPHA | ALPHANUMERIC
+    # digit-char-p only knows 0-9
+    if ord("0") <= code <= ord("9"):
+        flags |= ALPHANUMERIC
+    if not any(lo <= code <= hi for (lo, hi) in NOT_GRAPHIC):
+        flags |= GRAPHIC
+    return (CATEGORIES.index(category), flags, delta)
+
+def build():
+    # Record 0 is what codes outside the table get
+    records = {(0, 0, 0): 0}
+    blocks = {}
+    stage1 = []
+    for block in range(CHAR_CODE_LIMIT // BLOCK_SIZE):
+        base = block * BLOCK_SIZE
+        entries = tuple(records.setdefault(properties(code), len(records))
+                        for code in range(base, base + BLOCK_SIZE))
+        stage1.append(blocks.setdefault(entries, len(blocks)))
+    assert len(records) <= 256 and len(blocks) <= 256
+    return (sorted(records, key=records.get), sorted(blocks, key=blocks.get), stage1)
+
+def rows(values, per_line):
+    values = list(values)
+    for i in range(0, len(values), per_line):
+        yield "  " + ", ".join(str(v) for v in values[i:i + per_line]) + ","
+
+def main(out):
+    records, blocks, stage1 = build()
+    print("/*", file=out)
+    print("    File: unicodeTables.cc", file=out)
+    print("*/", file=out)
+    print("", file=out)
+    print("/* Generated by tools-for-build/unicode_tables.py from the Unicode %s" % unicodedata.unidata_version, file=out)
+    print("   character database - edit the script, not this file. */", file=out)
+    print("", file=out)
+    print("#include <clasp/core/foundation.h>", file=out)
+    print("#include <clasp/core/character.h>", file=out)
+    print("", file=out)
+    print("namespace core {", file=out)
+    print("", file=out)
+    print("const char* unicode_general_category_names[] = {", file=out)
+    for line in rows(('"%s"' % c for c in CATEGORIES), 6):
+        print(line, file=out)
+    print("};", file=out)
+    print("", file=out)
+    print("const UnicodeProperties unicode_properties[] = {", file=out)
+    for line in rows(("{%d,%d,%d}" % r for r in records), 6):
+        print(line, file=out)
+    print("};", file=out)
+    print("", file=out)
+    print("const uint8_t unicode_property_blocks[] = {", file=out)
+    for line in rows(stage1, 24):
+        print(line, file=out)
+    print("};", file=out)
+    print("", file=out)
+    print("const uint8_t unicode_property_records[][1<<UNICODE_BLOCK_SHIFT] = {", file=out)
+    for block in blocks:
+        print("  {", file=out)
+        for line in rows(block, 32):
+            print("  " + line, file=out)
+        print("  },", file=out)
+    print("};", file=out)
+    print("", file=out)
+    print("};", file=out)
+
+if __name__ == "__main__":
+    main(sys.stdout)